@@ -1,18 +1,26 @@
 INCLUDEPATH += $$PWD
 
 HEADERS += \
+    $$PWD/ct/ct_aggregate_trait.hpp \
+    $$PWD/ct/ct_array_unroll.hpp \
     $$PWD/ct/ct_bytes_utils.hpp \
     $$PWD/ct/ct_count_bytes.hpp \
     $$PWD/ct/ct_count_values.hpp \
     $$PWD/ct/ct_flatten_trait.hpp \
     $$PWD/ct/ct_test_equal.hpp \
+    $$PWD/ct/serialization/ct_serialization_columnar.hpp \
     $$PWD/ct/serialization/ct_serialization_pack.hpp \
     $$PWD/ct/serialization/ct_serialization_print.hpp \
     $$PWD/ct/serialization/ct_serialization_unpack.hpp \
+    $$PWD/ct/serialization/ct_serialization_view.hpp \
     $$PWD/ct/serialization/utils/ct_serialization_utils.hpp \
     $$PWD/ct/serialization/utils/ct_serialization_utils_memcpy_values_count.hpp \
     $$PWD/ct/serialization/utils/ct_serialization_utils_offsets.hpp \
+    $$PWD/ct/serialization/utils/ct_serialization_utils_policy.hpp \
+    $$PWD/ct/serialization/utils/ct_serialization_utils_prefetch.hpp \
     $$PWD/ct/utils/ct_utils_accumulate.hpp \
+    $$PWD/ct/utils/ct_utils_byte_order.hpp \
+    $$PWD/ct/utils/ct_utils_constexpr.hpp \
     $$PWD/ct/utils/ct_utils_index_sequence.hpp \
     $$PWD/ct/utils/ct_utils_nth_type_of.hpp \
     $$PWD/ct/utils/typelist/ct_utils_typelist.hpp \
@@ -20,4 +28,5 @@ HEADERS += \
     $$PWD/ct/utils/typelist/ct_utils_typelist_flatten.hpp \
     $$PWD/ct/utils/typelist/ct_utils_typelist_join.hpp \
     $$PWD/ct/utils/typelist/ct_utils_typelist_repeat.hpp \
+    $$PWD/ct/utils/typelist/ct_utils_typelist_skip_types.hpp \
     $$PWD/ct/utils/typelist/ct_utils_typelist_to_tuple.hpp
@@ -0,0 +1,222 @@
+#ifndef CT__AGGREGATE_TRAIT_HPP
+#define CT__AGGREGATE_TRAIT_HPP
+
+#include "ct/utils/ct_utils_constexpr.hpp"
+#include "ct/utils/ct_utils_index_sequence.hpp"
+
+#include <array>
+#include <cstddef> // for std::size_t
+#include <tuple>
+#include <type_traits>
+
+/**
+    Automatic decomposition of plain aggregates into their fields (C++17).
+
+    Plain structs (without constructors, base classes and private fields) may
+    be packed & unpacked as-is, without listing of their fields by hand - like
+    `std::tuple` of their fields:
+
+    @code{.cpp}
+    struct vec3 { float x, y, z; };
+
+    const auto bytes = ct::serialization::pack( vec3{1.f, 2.f, 3.f} );
+    @endcode
+
+    Fields count is detected by aggregate initialization (`T{ any, any, ... }`),
+    fields themselves are accessed by structured bindings. So:
+
+    - `CT_HAS_AGGREGATE_DECOMPOSITION` - `1` if structured bindings, `if
+      constexpr` and `std::is_aggregate<T>` are available, otherwise `0` (then
+      aggregates are not detected at all, as before).
+    - Up to 16 fields are supported.
+    - Fields of raw array types are not supported (aggregate initialization
+      counts their items, due to braces elision) - use `std::array` instead.
+*/
+
+#if defined(__cpp_structured_bindings) && (__cpp_structured_bindings >= 201606L) && \
+    defined(__cpp_if_constexpr) && (__cpp_if_constexpr >= 201606L) && \
+    defined(__cpp_lib_is_aggregate) && (__cpp_lib_is_aggregate >= 201703L)
+    #define CT_HAS_AGGREGATE_DECOMPOSITION 1
+#else
+    #define CT_HAS_AGGREGATE_DECOMPOSITION 0
+#endif
+
+namespace ct {
+
+#if CT_HAS_AGGREGATE_DECOMPOSITION
+
+namespace impl {
+
+// Convertible to any type - placeholder of single field in aggregate
+// initialization (used only in unevaluated context)
+struct any_field
+{
+    template <typename T>
+    constexpr operator T() const noexcept;
+};
+
+template <typename T, typename Indexes, typename Enabled = void>
+struct is_braces_constructible
+        : std::false_type
+{};
+
+template <typename T, int ... Indexes>
+struct is_braces_constructible< T, ct::ind_seq::index<Indexes...>, std::void_t< decltype( T{ (static_cast<void>(Indexes), any_field{}) ... } ) > >
+        : std::true_type
+{};
+
+// Count of fields - the biggest count of initializers, which is accepted
+template <typename T, std::size_t COUNT = 0,
+          bool IS_MORE = is_braces_constructible< T, ct::ind_seq::make_index_t<COUNT + 1> >::value>
+struct fields_count
+        : fields_count<T, COUNT + 1>
+{};
+
+template <typename T, std::size_t COUNT>
+struct fields_count<T, COUNT, false>
+        : std::integral_constant<std::size_t, COUNT>
+{};
+
+template <typename T, bool IS_CANDIDATE = std::is_class<T>::value && std::is_aggregate<T>::value>
+struct is_decomposable_aggregate
+        : std::integral_constant<bool, (fields_count<T>::value > 0)>
+{};
+
+template <typename T>
+struct is_decomposable_aggregate<T, false>
+        : std::false_type
+{};
+
+// std::array is aggregate too, but it has own traits
+template <typename T, std::size_t SIZE>
+struct is_decomposable_aggregate< std::array<T, SIZE>, true >
+        : std::false_type
+{};
+
+// Collects types of fields (used only in unevaluated context)
+struct fields_types
+{
+    template <typename ... Fields>
+    std::tuple< typename std::remove_cv<Fields>::type ... > operator()(Fields& ...) const;
+};
+
+} // namespace impl
+
+// Is `T` a plain aggregate struct, which is packed field-by-field
+template <typename T>
+struct is_decomposable_aggregate
+        : impl::is_decomposable_aggregate<T>
+{};
+
+/**
+    Access to fields of aggregate `T`:
+
+    - `fields_count` - count of fields.
+    - `fields_t` - `std::tuple` of fields types.
+    - `apply(value, f)` - calls `f(fields...)` with references to all fields
+      of `value` (const, if `value` is const).
+*/
+template <typename T>
+struct aggregate_trait
+{
+    static_assert(is_decomposable_aggregate<T>::value, "T must be a plain aggregate");
+
+    static constexpr std::size_t fields_count = impl::fields_count<T>::value;
+
+    static_assert(fields_count <= 16, "Aggregates with more than 16 fields are not supported - use std::tuple instead");
+
+    template <typename U, typename F>
+    static constexpr decltype(auto) apply(U& value, F&& f)
+    {
+        if constexpr (fields_count == 1) {
+            auto& [f0] = value;
+            return f(f0);
+        } else if constexpr (fields_count == 2) {
+            auto& [f0, f1] = value;
+            return f(f0, f1);
+        } else if constexpr (fields_count == 3) {
+            auto& [f0, f1, f2] = value;
+            return f(f0, f1, f2);
+        } else if constexpr (fields_count == 4) {
+            auto& [f0, f1, f2, f3] = value;
+            return f(f0, f1, f2, f3);
+        } else if constexpr (fields_count == 5) {
+            auto& [f0, f1, f2, f3, f4] = value;
+            return f(f0, f1, f2, f3, f4);
+        } else if constexpr (fields_count == 6) {
+            auto& [f0, f1, f2, f3, f4, f5] = value;
+            return f(f0, f1, f2, f3, f4, f5);
+        } else if constexpr (fields_count == 7) {
+            auto& [f0, f1, f2, f3, f4, f5, f6] = value;
+            return f(f0, f1, f2, f3, f4, f5, f6);
+        } else if constexpr (fields_count == 8) {
+            auto& [f0, f1, f2, f3, f4, f5, f6, f7] = value;
+            return f(f0, f1, f2, f3, f4, f5, f6, f7);
+        } else if constexpr (fields_count == 9) {
+            auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8] = value;
+            return f(f0, f1, f2, f3, f4, f5, f6, f7, f8);
+        } else if constexpr (fields_count == 10) {
+            auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9] = value;
+            return f(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9);
+        } else if constexpr (fields_count == 11) {
+            auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10] = value;
+            return f(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10);
+        } else if constexpr (fields_count == 12) {
+            auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11] = value;
+            return f(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11);
+        } else if constexpr (fields_count == 13) {
+            auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12] = value;
+            return f(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12);
+        } else if constexpr (fields_count == 14) {
+            auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13] = value;
+            return f(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13);
+        } else if constexpr (fields_count == 15) {
+            auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14] = value;
+            return f(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14);
+        } else {
+            auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15] = value;
+            return f(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15);
+        }
+    }
+
+    using fields_t = decltype( apply( std::declval<T&>(), impl::fields_types{} ) );
+};
+
+#else
+
+template <typename T>
+struct is_decomposable_aggregate
+        : std::false_type
+{};
+
+#endif // CT_HAS_AGGREGATE_DECOMPOSITION
+
+// -----------------------------------------------------------------------------
+
+#if defined(CT_ENABLE_TESTS) && CT_HAS_AGGREGATE_DECOMPOSITION
+namespace tests {
+
+    struct aggregate_2_t { int a; float b; };
+    struct aggregate_nested_t { aggregate_2_t inner; std::array<short, 3> items; char c; };
+    struct non_aggregate_t { non_aggregate_t(int) {} };
+    struct empty_t {};
+
+    static_assert( aggregate_trait<aggregate_2_t>::fields_count == 2, "Test failed");
+    static_assert( aggregate_trait<aggregate_nested_t>::fields_count == 3, "Test failed");
+
+    static_assert( std::is_same< aggregate_trait<aggregate_nested_t>::fields_t, std::tuple<aggregate_2_t, std::array<short, 3>, char> >::value, "Test failed");
+
+    static_assert( is_decomposable_aggregate<aggregate_2_t>::value == true, "Test failed");
+    static_assert( is_decomposable_aggregate<non_aggregate_t>::value == false, "Test failed");
+    static_assert( is_decomposable_aggregate<empty_t>::value == false, "Test failed");
+    static_assert( is_decomposable_aggregate<int>::value == false, "Test failed");
+    static_assert( is_decomposable_aggregate< std::array<int, 2> >::value == false, "Test failed");
+    static_assert( is_decomposable_aggregate< std::pair<int, int> >::value == false, "Test failed");
+    static_assert( is_decomposable_aggregate< std::tuple<int, int> >::value == false, "Test failed");
+
+} // namespace tests
+#endif // defined(CT_ENABLE_TESTS) && CT_HAS_AGGREGATE_DECOMPOSITION
+
+} // namespace ct
+
+#endif // CT__AGGREGATE_TRAIT_HPP
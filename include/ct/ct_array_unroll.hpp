@@ -0,0 +1,75 @@
+#ifndef CT__ARRAY_UNROLL_HPP
+#define CT__ARRAY_UNROLL_HPP
+
+#include "ct/ct_count_bytes.hpp"
+
+#include <array>
+#include <cstddef> // for std::size_t
+#include <type_traits>
+
+/**
+    Unroll threshold for arrays of non-scalar types.
+
+    By default arrays of non-scalar types (like `std::array<std::pair<i32, f32>, N>`)
+    are unrolled item-by-item: flattened into `N * (items leaves)` fields, each
+    with its own compile-time offset and own pack/unpack instantiation. That is
+    the fastest code for small arrays, but compile time and binary size grow
+    linearly with `N`.
+
+    Arrays with more than `CT_ARRAY_UNROLL_THRESHOLD` items are "looped"
+    instead: array is a single flattened field, and its items are packed by
+    runtime loop with fixed stride `ct::get_bytes_count<T>()` (items are placed
+    densely, without any padding between them).
+
+    Threshold may be redefined before including of any `ct` header. Bytes
+    layout (for default `packed` fields layout) doesn't depend on it.
+
+    Arrays of plain aggregates without padding (see `ct::is_packed_aggregate<T>`)
+    are never unrolled - with native byte order their bytes are copied by
+    single `std::memcpy()`, as for arrays of scalars.
+*/
+#if !defined(CT_ARRAY_UNROLL_THRESHOLD)
+    #define CT_ARRAY_UNROLL_THRESHOLD 256
+#endif
+
+namespace ct {
+
+// Is `T` an array of non-scalar types, which is packed as single flattened
+// value: too big for unrolling, or array of aggregates without padding
+template <typename T>
+struct is_looped_array
+        : std::false_type
+{};
+
+template <typename T, std::size_t SIZE>
+struct is_looped_array< std::array<T, SIZE> >
+        : std::integral_constant<bool, (std::is_scalar<T>::value == false) && ((SIZE > CT_ARRAY_UNROLL_THRESHOLD) || ct::is_packed_aggregate<T>::value)>
+{};
+
+template <typename T, std::size_t SIZE>
+struct is_looped_array< T[SIZE] >
+        : std::integral_constant<bool, (std::is_scalar<T>::value == false) && ((SIZE > CT_ARRAY_UNROLL_THRESHOLD) || ct::is_packed_aggregate<T>::value)>
+{};
+
+// -----------------------------------------------------------------------------
+
+#if defined(CT_ENABLE_TESTS)
+namespace tests {
+
+    static_assert( is_looped_array< std::array<int, (CT_ARRAY_UNROLL_THRESHOLD + 1)> >::value == false, "Test failed"); // Scalar arrays are packed as single value anyway
+    static_assert( is_looped_array< std::array<std::pair<int, int>, CT_ARRAY_UNROLL_THRESHOLD> >::value == false, "Test failed");
+    static_assert( is_looped_array< std::array<std::pair<int, int>, (CT_ARRAY_UNROLL_THRESHOLD + 1)> >::value == true, "Test failed");
+    static_assert( is_looped_array< std::pair<int, int>[CT_ARRAY_UNROLL_THRESHOLD + 1] >::value == true, "Test failed");
+
+#if CT_HAS_AGGREGATE_DECOMPOSITION
+    struct looped_vec3_t { float x, y, z; };
+
+    static_assert( is_looped_array< std::array<looped_vec3_t, 2> >::value == true, "Test failed"); // Without padding - single value anyway
+#endif
+
+} // namespace tests
+#endif // defined(CT_ENABLE_TESTS)
+
+} // namespace ct
+
+#endif // CT__ARRAY_UNROLL_HPP
@@ -2,16 +2,20 @@
 #define CT__COUNT_BYTES_HPP
 
 #include "ct/utils/ct_utils_accumulate.hpp"
+#include "ct/ct_aggregate_trait.hpp"
+
+#include <cstdint> // for std::int8_t, std::int16_t, ...
+#include <type_traits> // for std::is_trivial<T>, std::is_standard_layout<T>
 
 namespace ct {
 
 namespace impl {
 
 // Default implementation for POD-types
-template <typename T>
+template <typename T, typename Enabled = void>
 struct bytes_count_trait
 {
-    static_assert(std::is_pod<T>::value == true, "T must be POD type");
+    static_assert(std::is_trivial<T>::value && std::is_standard_layout<T>::value, "T must be POD type"); // std::is_pod<T> is deprecated since C++20
 
     static constexpr std::size_t bytes_count = sizeof (T);
 };
@@ -48,6 +52,16 @@ struct bytes_count_trait< std::tuple<Types...> >
         = ct::utils::accumulate( { bytes_count_trait<Types>::bytes_count ...}, std::size_t{0});
 };
 
+#if CT_HAS_AGGREGATE_DECOMPOSITION
+// Specialization for plain aggregates: the same as for std::tuple of its fields
+template <typename T>
+struct bytes_count_trait< T, typename std::enable_if< ct::is_decomposable_aggregate<T>::value >::type >
+{
+    static constexpr std::size_t bytes_count
+        = bytes_count_trait< typename ct::aggregate_trait<T>::fields_t >::bytes_count;
+};
+#endif
+
 } // namespace impl
 
 // -----------------------------------------------------------------------------
@@ -59,6 +73,35 @@ constexpr std::size_t get_bytes_count() {
 
 // -----------------------------------------------------------------------------
 
+namespace impl {
+
+template <typename T, bool IS_DECOMPOSABLE = ct::is_decomposable_aggregate<T>::value>
+struct is_packed_aggregate
+        : std::false_type
+{};
+
+#if CT_HAS_AGGREGATE_DECOMPOSITION
+template <typename T>
+struct is_packed_aggregate<T, true>
+        : std::integral_constant<bool, std::is_trivially_copyable<T>::value && (sizeof(T) == get_bytes_count<T>())>
+{};
+#endif
+
+} // namespace impl
+
+/**
+    Is `T` a plain aggregate without any padding (also inside of nested
+    fields): its bytes in memory are exactly the same, as its packed bytes in
+    native byte order. So it may be copied by single `std::memcpy()` - as
+    single value (as well as arrays of such aggregates).
+*/
+template <typename T>
+struct is_packed_aggregate
+        : impl::is_packed_aggregate<T>
+{};
+
+// -----------------------------------------------------------------------------
+
 #if defined(CT_ENABLE_TESTS)
 namespace tests
 {
@@ -112,6 +155,24 @@ namespace tests
 
     static_assert( get_bytes_count< std::int8_t, std::int16_t, std::int32_t >() == (1+2+4), "Test failed");
 
+#if CT_HAS_AGGREGATE_DECOMPOSITION
+    // -------------------------------------------------------------------------
+    // Plain aggregates
+
+    struct packed_aggregate_t { std::int32_t a; float b; std::array<std::int16_t, 2> c; };
+    struct padded_aggregate_t { std::int8_t a; std::int32_t b; };
+    struct nested_aggregate_t { packed_aggregate_t inner; std::int32_t d; };
+
+    static_assert( get_bytes_count<packed_aggregate_t>() == (4+4+(2*2)), "Test failed");
+    static_assert( get_bytes_count<padded_aggregate_t>() == (1+4), "Test failed");
+    static_assert( get_bytes_count<nested_aggregate_t>() == ((4+4+(2*2))+4), "Test failed");
+
+    static_assert( is_packed_aggregate<packed_aggregate_t>::value == true, "Test failed");
+    static_assert( is_packed_aggregate<padded_aggregate_t>::value == false, "Test failed");
+    static_assert( is_packed_aggregate<nested_aggregate_t>::value == true, "Test failed");
+    static_assert( is_packed_aggregate< std::pair<std::int32_t, float> >::value == false, "Test failed"); // Not an aggregate
+#endif
+
 
 } // namespace tests
 #endif // defined(CT_ENABLE_TESTS)
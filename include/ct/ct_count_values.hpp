@@ -2,6 +2,7 @@
 #define CT__COUNT_VALUES_HPP
 
 #include "ct/utils/ct_utils_accumulate.hpp"
+#include "ct/ct_aggregate_trait.hpp"
 
 /*
     Important note : for collections, like raw arrays or std::arrays, returned
@@ -19,10 +20,10 @@ namespace ct {
 
 namespace impl {
 
-template <typename T>
+template <typename T, typename Enabled = void>
 struct count_values_trait
 {
-    static_assert(std::is_pod<T>::value == true, "T must be a POD type");
+    static_assert(std::is_trivial<T>::value && std::is_standard_layout<T>::value, "T must be a POD type"); // std::is_pod<T> is deprecated since C++20
 
     static constexpr std::size_t values_count = 1;
 };
@@ -59,6 +60,16 @@ struct count_values_trait< std::tuple<Types...> >
         = ct::utils::accumulate( { count_values_trait<Types>::values_count ...}, std::size_t{0});
 };
 
+#if CT_HAS_AGGREGATE_DECOMPOSITION
+// Specialization for plain aggregates: the same as for std::tuple of its fields
+template <typename T>
+struct count_values_trait< T, typename std::enable_if< ct::is_decomposable_aggregate<T>::value >::type >
+{
+    static constexpr std::size_t values_count
+        = count_values_trait< typename ct::aggregate_trait<T>::fields_t >::values_count;
+};
+#endif
+
 } // namespace impl
 
 // -----------------------------------------------------------------------------
@@ -3,6 +3,7 @@
 
 #include "ct/utils/typelist/ct_utils_typelist_flatten.hpp"
 #include "ct/utils/typelist/ct_utils_typelist_repeat.hpp"
+#include "ct/ct_array_unroll.hpp"
 
 #include <array>
 
@@ -10,10 +11,30 @@ namespace ct {
 
 namespace impl {
 
+template <typename ... Types>
+struct flatten_trait;
+
+// Plain aggregates with padding are flatten'ed as std::tuple of their fields,
+// other types (including aggregates without padding) - as is
+template <typename T,
+          bool IS_DECOMPOSED = ct::is_decomposable_aggregate<T>::value && (ct::is_packed_aggregate<T>::value == false)>
+struct aggregate_flatten_trait
+{
+    using type = T;
+};
+
+#if CT_HAS_AGGREGATE_DECOMPOSITION
+template <typename T>
+struct aggregate_flatten_trait<T, true>
+{
+    using type = typename flatten_trait< typename ct::aggregate_trait<T>::fields_t >::type;
+};
+#endif
+
 // Specialization for flatten'ing parameter pack: <Types...> -> List<Types...>
 template <typename ... Types>
 struct flatten_trait
-        : ct::utils::flatten< ct::utils::List<Types ...> >
+        : ct::utils::flatten< ct::utils::List< typename aggregate_flatten_trait<Types>::type ...> >
 {};
 
 // -----------------------------------------------------------------------------
@@ -32,30 +53,30 @@ struct flatten_trait< std::tuple<Types...> >
 
 // -----------------------------------------------------------------------------
 
-// Specialization for flatten'ing: std::array<T, SIZE> --> List<T ... SIZE>
-template <typename T, std::size_t SIZE>
-struct flatten_trait< std::array<T, SIZE> > :
-        std::conditional<
-            (std::is_scalar<T>::value == true), // Note: here is used std::is_scalar, instead of std::is_pod, because otherwise nested arrays-in-arrays not unpacked into flat form of arrays
-
-            ct::utils::flatten< std::array<T,SIZE> >, // Not flatten_trait here (but ct::utils::flatten) to not make circular dependency
+// Common implementation for arrays: items of non-scalar types are unrolled
+// (repeated) - only if it is required, because repeating of thousands items
+// is expensive even as unused branch of std::conditional
+template <typename Array, typename T, std::size_t SIZE,
+          bool IS_SINGLE = (std::is_scalar<T>::value == true) || ct::is_looped_array<Array>::value> // Note: here is used std::is_scalar, instead of std::is_pod, because otherwise nested arrays-in-arrays not unpacked into flat form of arrays. Too big arrays are not unrolled (see CT_ARRAY_UNROLL_THRESHOLD)
+struct array_flatten_trait
+        : ct::utils::flatten< Array > // Not flatten_trait here (but ct::utils::flatten) to not make circular dependency
+{};
 
-            flatten_trait< typename ct::utils::repeat< typename flatten_trait<T>::type, SIZE>::type >
+template <typename Array, typename T, std::size_t SIZE>
+struct array_flatten_trait<Array, T, SIZE, false>
+        : flatten_trait< typename ct::utils::repeat< typename flatten_trait<T>::type, SIZE>::type >
+{};
 
-        >::type
+// Specialization for flatten'ing: std::array<T, SIZE> --> List<T ... SIZE>
+template <typename T, std::size_t SIZE>
+struct flatten_trait< std::array<T, SIZE> >
+        : array_flatten_trait< std::array<T, SIZE>, T, SIZE >
 {};
 
 // Specialization for flatten'ing raw array: T[SIZE] --> List<T ... SIZE>
 template <typename T, std::size_t SIZE>
-struct flatten_trait< T[SIZE] > :
-        std::conditional<
-            (std::is_scalar<T>::value == true), // Note: here is used std::is_scalar, instead of std::is_pod, because otherwise nested arrays-in-arrays not unpacked into flat form of arrays
-
-            ct::utils::flatten< T[SIZE] >, // Not flatten_trait here (but ct::utils::flatten) to not make circular dependency
-
-            flatten_trait< typename ct::utils::repeat< typename flatten_trait<T>::type, SIZE>::type >
-
-        >::type
+struct flatten_trait< T[SIZE] >
+        : array_flatten_trait< T[SIZE], T, SIZE >
 {};
 
 } // namespace impl
@@ -83,6 +104,9 @@ namespace tests {
     static_assert( std::is_same< flattened< std::tuple< std::array<int, 2>, std::array<int, 3> > >::type, ct::utils::List<std::array<int,2>, std::array<int,3>> >::value, "Test failed"); // Nested arrays unpacked
     static_assert( std::is_same< flattened< std::tuple< std::array<int, 1>, std::array<int, 2>, std::array<int, 3> > >::type, ct::utils::List< std::array<int, 1>, std::array<int, 2>, std::array<int, 3> > >::value, "asd"); // Arrays of POD-types non-unpacked
 
+    // Too big arrays of non-scalar types are not unrolled
+    static_assert( std::is_same< flattened< bool, std::array< std::pair<int,int>, (CT_ARRAY_UNROLL_THRESHOLD + 1)> >::type, ct::utils::List<bool, std::array< std::pair<int,int>, (CT_ARRAY_UNROLL_THRESHOLD + 1)>> >::value, "Test failed");
+
     // std::pair and std::tuple flatten'ing
     static_assert( std::is_same< flattened< std::pair<int, float> >::type, ct::utils::List<int, float> >::value, "Test failed");
     static_assert( std::is_same< flattened< std::tuple<bool, int, float> >::type, ct::utils::List<bool, int, float> >::value, "Test failed");
@@ -97,6 +121,16 @@ namespace tests {
     static_assert( std::is_same< flattened< std::pair<bool, int>, std::array<float,3> >::type, ct::utils::List<bool, int, std::array<float,3>> >::value, "Test failed");
     static_assert( std::is_same< flattened< std::tuple<bool, int, float>, double >::type, ct::utils::List<bool, int, float, double> >::value, "Test failed");
 
+#if CT_HAS_AGGREGATE_DECOMPOSITION
+    // Plain aggregates: with padding - flatten'ed as their fields, without - as is
+    struct flatten_packed_t { int a; float b; };
+    struct flatten_padded_t { char a; flatten_packed_t b; std::pair<bool, int> c; };
+
+    static_assert( std::is_same< flattened< flatten_packed_t >::type, ct::utils::List<flatten_packed_t> >::value, "Test failed");
+    static_assert( std::is_same< flattened< flatten_padded_t, double >::type, ct::utils::List<char, flatten_packed_t, bool, int, double> >::value, "Test failed");
+    static_assert( std::is_same< flattened< std::array<flatten_packed_t, 3> >::type, ct::utils::List< std::array<flatten_packed_t, 3> > >::value, "Test failed");
+#endif
+
 } // namespace tests
 #endif // defined(CT_ENABLE_TESTS)
 
@@ -32,13 +32,27 @@ struct collection_equal_utils
     using a_item_getter = item_a_t const& (*) (const collection_a_t& a, std::size_t idx);
     using b_item_getter = item_b_t const& (*) (const collection_b_t& b, std::size_t idx);
 
+    // Items in range [first, last) are compared by splitting into halves, so
+    // constexpr evaluation depth is log2(SIZE), not SIZE
+    static constexpr bool items_equal_range(
+            const collection_a_t& a, const collection_b_t& b,
+            const a_item_getter& get_a, const b_item_getter& get_b,
+            std::size_t first, std::size_t last)
+    {
+        return ((last - first) == 1) ?
+            equal_trait<item_a_t, item_b_t>::equal(get_a(a, first), get_b(b, first))
+            :
+            ( items_equal_range(a, b, get_a, get_b, first, first + ((last - first) / 2)) &&
+              items_equal_range(a, b, get_a, get_b, first + ((last - first) / 2), last) );
+    }
+
     static constexpr bool items_equal(
             const collection_a_t& a, const collection_b_t& b,
-            const std::size_t SIZE_A, const std::size_t SIZE_B,
+            const std::size_t SIZE_A, const std::size_t /*SIZE_B*/,
             const a_item_getter& get_a, const b_item_getter& get_b,
             std::size_t i = 0)
     {
-        return (i < SIZE_A) ? ( equal_trait<item_a_t, item_b_t>::equal(get_a(a, i), get_b(b, i)) && items_equal(a, b, SIZE_A, SIZE_B, get_a, get_b, i+1) ) : true;
+        return (i < SIZE_A) ? items_equal_range(a, b, get_a, get_b, i, SIZE_A) : true;
     }
 
     static constexpr bool equal(
@@ -164,6 +178,8 @@ namespace tests {
 
     // Check of comparation: std::array <--> std::array
     static_assert( equal( std::array<std::int32_t, 3>{1,2,3}, std::array<std::int32_t, 3>{1,2,3}) == true, "Test failed");
+    static_assert( equal( std::array<std::int32_t, 3>{1,2,3}, std::array<std::int32_t, 3>{1,2,4}) == false, "Test failed");
+    static_assert( equal( std::array<std::int32_t, 0>{}, std::array<std::int32_t, 0>{}) == true, "Test failed");
 
     // Check of comparation: std::array <--> std::initializer_list
     static_assert( equal( std::array<std::int32_t, 3>{1,2,3}, std::initializer_list<int>{1,2,3}) == true, "Test failed");
@@ -0,0 +1,289 @@
+#ifndef CT__SERIALIZATION__COLUMNAR_HPP
+#define CT__SERIALIZATION__COLUMNAR_HPP
+
+#include "ct/serialization/ct_serialization_pack.hpp"
+#include "ct/serialization/ct_serialization_unpack.hpp"
+
+#include "ct/utils/typelist/ct_utils_typelist_to_tuple.hpp"
+
+#include <cstring>  // for std::memcpy(), std::memset()
+#include <iterator> // for std::iterator_traits<T>, std::distance()
+#include <tuple>    // for std::tuple_element<I, T>
+
+namespace ct {
+
+namespace serialization {
+
+/**
+    Columnar (structure-of-arrays) layout for many same-typed records.
+
+    Instead of placing N records one after another (row-major, like
+    `pack_range()` do), each flattened leaf field of the record gets its own
+    continuous column of N values:
+
+    @code
+    record: < i32, <i8, i16> >          (flattened: i32, i8, i16)
+    flat offsets: [0, 4, 5], record bytes count: 7
+
+    row-major (N=3): [i32 i8 i16][i32 i8 i16][i32 i8 i16]
+    columnar  (N=3): [i32 i32 i32][i8 i8 i8][i16 i16 i16]
+                     ^            ^         ^
+                     0 = 3*0      12 = 3*4  15 = 3*5
+    @endcode
+
+    Column K starts at `N * flat_offsets[K]` - the same compile-time offsets
+    table (just scaled by records count), so no extra tables needed. Total
+    bytes count is the same as for row-major packing:
+    `N * packed_bytes_count<record_t>()`.
+
+    Policy may be attached as for `values_packer`:
+    `columnar_trait< with_policy<Policy, record_t> >` (or by `pack_columns_with()`
+    & `unpack_columns_with()`). With `fields_layout::packed` (default) columns
+    follow each other without gaps. With `fields_layout::aligned` and
+    `fields_layout::reordered` flat offsets contain padding, so columns are
+    separated by gaps of `N * padding` bytes (and followed by `N * tail padding`
+    bytes) - in exchange each column starts at offset, multiple of its field
+    alignment. Gaps are zeroed:
+
+    @code
+    record: < i8, i32 > aligned         (offsets: [0, 4], record bytes count: 8)
+
+    columnar  (N=3): [i8 i8 i8]000000000[i32 i32 i32]
+                     ^                  ^
+                     0 = 3*0            12 = 3*4
+    @endcode
+
+    Each record packed as usual (into small temporary row), then its leaf fields
+    scattered into columns (and gathered back during unpacking). All per-field
+    offsets & sizes are compile-time constants.
+*/
+template <typename ... Types>
+struct columnar_trait;
+
+namespace impl {
+
+template <typename Policy, typename ... Types>
+struct columnar_trait_impl
+{
+    using packer_t = values_packer< with_policy<Policy, Types...> >;
+    using unpacker_t = values_unpacker< with_policy<Policy, Types...> >;
+
+    using info_t = typename packer_t::info_t;
+    using byte_t = typename info_t::byte_t;
+
+    using flat_list_t = typename ct::flattened<Types...>::type;
+
+    static constexpr std::size_t columns_count = info_t::flat_offsets_maker_t::count;
+
+    // Type of the single value in column (flattened leaf field)
+    template <std::size_t COLUMN_IDX>
+    using column_t = typename std::tuple_element<COLUMN_IDX, typename ct::utils::list_to_tuple<flat_list_t>::type>::type;
+
+    // Bytes count for `records_count` records (the same as for row-major)
+    static constexpr std::size_t bytes_count(std::size_t records_count) {
+        return records_count * info_t::bytes_count;
+    }
+
+    // Column start, inside of buffer with `records_count` records
+    template <std::size_t COLUMN_IDX>
+    static constexpr std::size_t column_offset(std::size_t records_count) {
+        return records_count * std::get<COLUMN_IDX>( info_t::get_offsets() );
+    }
+
+    // -------------------------------------------------------------------------
+
+    template <int ... Columns>
+    static void scatter(byte_t* dest, std::size_t records_count, std::size_t record_idx, const byte_t* row, ct::ind_seq::index<Columns...>)
+    {
+        using dummy_t = int[];
+        (void) dummy_t {
+            ( std::memcpy(
+                  dest + column_offset<Columns>(records_count) + (record_idx * std::get<Columns>( info_t::get_sizeofs() )),
+                  row  + std::get<Columns>( info_t::get_offsets() ),
+                  std::get<Columns>( info_t::get_sizeofs() )
+              ), /* for making dummy_t: */ 0) ...
+        };
+    }
+
+    template <int ... Columns>
+    static void gather(byte_t* row, const byte_t* src, std::size_t records_count, std::size_t record_idx, ct::ind_seq::index<Columns...>)
+    {
+        using dummy_t = int[];
+        (void) dummy_t {
+            ( std::memcpy(
+                  row + std::get<Columns>( info_t::get_offsets() ),
+                  src + column_offset<Columns>(records_count) + (record_idx * std::get<Columns>( info_t::get_sizeofs() )),
+                  std::get<Columns>( info_t::get_sizeofs() )
+              ), /* for making dummy_t: */ 0) ...
+        };
+    }
+
+    // -------------------------------------------------------------------------
+
+    // Zeroes gaps between columns (of aligned & reordered layouts), so packed
+    // bytes don't depend on previous buffer contents. Must be called before
+    // packing of records. For packed layout - does nothing
+    static void clear_padding(byte_t* dest, std::size_t records_count)
+    {
+        if(info_t::policy_t::layout != fields_layout::packed) {
+            std::memset(dest, 0, bytes_count(records_count));
+        }
+    }
+
+    // Pack single record (at `record_idx`) into columnar buffer, which contains
+    // `records_count` records
+    static void pack_record(byte_t* dest, std::size_t records_count, std::size_t record_idx, const Types& ... values)
+    {
+        typename info_t::byte_buffer_t row;
+        packer_t::template pack_values<0>(row.data(), values...);
+
+        scatter(dest, records_count, record_idx, row.data(), ct::ind_seq::gen_seq<columns_count>{});
+    }
+
+    // Unpack single record (at `record_idx`) from columnar buffer, which
+    // contains `records_count` records
+    static void unpack_record(const byte_t* src, std::size_t records_count, std::size_t record_idx, Types& ... values)
+    {
+        typename info_t::byte_buffer_t row;
+        gather(row.data(), src, records_count, record_idx, ct::ind_seq::gen_seq<columns_count>{});
+
+        unpacker_t::template unpack_values<0>(row.data(), values...);
+    }
+};
+
+} // namespace impl
+
+template <typename ... Types>
+struct columnar_trait
+        : impl::columnar_trait_impl<default_policy, Types...>
+{};
+
+// Specialization for types with attached policy
+template <typename Policy, typename ... Types>
+struct columnar_trait< with_policy<Policy, Types...> >
+        : impl::columnar_trait_impl<Policy, Types...>
+{};
+
+// -----------------------------------------------------------------------------
+// Convenient functions with implicit types deduction
+
+/**
+    Packs records range `[first, last)` into columnar layout.
+
+    @code{.cpp}
+    using record_t = std::tuple<std::uint32_t, float, std::pair<std::int8_t, double>>;
+    using columnar_t = ct::serialization::columnar_trait<record_t>;
+
+    std::vector<record_t> records = { ... };
+
+    std::vector<std::int8_t> bytes( columnar_t::bytes_count(records.size()) );
+    ct::serialization::pack_columns(bytes.data(), records.begin(), records.end());
+
+    // All `float`s, one after another
+    const std::int8_t* floats = bytes.data() + columnar_t::column_offset<1>(records.size());
+    @endcode
+
+    @return Count of written bytes
+*/
+template <typename ForwardIt,
+
+          // Deduced types
+          typename record_t = typename std::iterator_traits<ForwardIt>::value_type,
+          typename columnar_t = columnar_trait<record_t>
+          >
+inline std::size_t pack_columns(typename columnar_t::byte_t* dest, ForwardIt first, ForwardIt last)
+{
+    const std::size_t records_count = static_cast<std::size_t>( std::distance(first, last) );
+
+    columnar_t::clear_padding(dest, records_count);
+    for(std::size_t i = 0; first != last; ++first, ++i) {
+        columnar_t::pack_record(dest, records_count, i, *first);
+    }
+
+    return columnar_t::bytes_count(records_count);
+}
+
+/**
+    Opposite to `pack_columns()` - unpacks `count` records from columnar layout
+    into `out` (which must be dereferenceable into record reference).
+
+    @return Iterator past the last unpacked record
+*/
+template <typename OutputIt,
+
+          // Deduced types
+          typename record_t = typename std::iterator_traits<OutputIt>::value_type,
+          typename columnar_t = columnar_trait<record_t>,
+          typename byte_t = typename columnar_t::byte_t
+          >
+inline OutputIt unpack_columns(const byte_t* src, std::size_t count, OutputIt out)
+{
+    for(std::size_t i = 0; i < count; ++i, ++out) {
+        columnar_t::unpack_record(src, count, i, *out);
+    }
+
+    return out;
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// The same, but with explicitly specified policy (for example - fields layout)
+
+template <typename Policy, typename ForwardIt,
+
+          // Deduced types
+          typename record_t = typename std::iterator_traits<ForwardIt>::value_type,
+          typename columnar_t = columnar_trait< with_policy<Policy, record_t> >
+          >
+inline std::size_t pack_columns_with(typename columnar_t::byte_t* dest, ForwardIt first, ForwardIt last)
+{
+    return pack_columns<ForwardIt, record_t, columnar_t>(dest, first, last);
+}
+
+template <typename Policy, typename OutputIt,
+
+          // Deduced types
+          typename record_t = typename std::iterator_traits<OutputIt>::value_type,
+          typename columnar_t = columnar_trait< with_policy<Policy, record_t> >,
+          typename byte_t = typename columnar_t::byte_t
+          >
+inline OutputIt unpack_columns_with(const byte_t* src, std::size_t count, OutputIt out)
+{
+    return unpack_columns<OutputIt, record_t, columnar_t>(src, count, out);
+}
+
+// -----------------------------------------------------------------------------
+
+#if defined(CT_ENABLE_TESTS)
+namespace tests {
+
+    using columnar_input_t = std::tuple< std::int32_t, std::pair<std::int8_t, std::int16_t>, std::array<std::int32_t, 2> >;
+
+    static_assert( columnar_trait<columnar_input_t>::columns_count == 4, "Test failed");
+
+    static_assert( columnar_trait<columnar_input_t>::column_offset<0>(3) == 3*0, "Test failed");
+    static_assert( columnar_trait<columnar_input_t>::column_offset<1>(3) == 3*4, "Test failed");
+    static_assert( columnar_trait<columnar_input_t>::column_offset<2>(3) == 3*5, "Test failed");
+    static_assert( columnar_trait<columnar_input_t>::column_offset<3>(3) == 3*7, "Test failed");
+
+    static_assert( columnar_trait<columnar_input_t>::bytes_count(3) == 3*15, "Test failed");
+
+    static_assert( std::is_same< columnar_trait<columnar_input_t>::column_t<2>, std::int16_t >::value, "Test failed");
+    static_assert( std::is_same< columnar_trait<columnar_input_t>::column_t<3>, std::array<std::int32_t, 2> >::value, "Test failed");
+
+    // Aligned: offsets [0, 4, 6, 8], record bytes count 16
+    using columnar_aligned_t = columnar_trait< with_policy< policy<ct::utils::byte_order::native, fields_layout::aligned>, columnar_input_t > >;
+
+    static_assert( columnar_aligned_t::column_offset<1>(3) == 3*4, "Test failed");
+    static_assert( columnar_aligned_t::column_offset<2>(3) == 3*6, "Test failed");
+    static_assert( columnar_aligned_t::column_offset<3>(3) == 3*8, "Test failed");
+
+    static_assert( columnar_aligned_t::bytes_count(3) == 3*16, "Test failed");
+
+} // namespace tests
+#endif // defined(CT_ENABLE_TESTS)
+
+} // namespace serialization
+
+} // namespace ct
+
+#endif // CT__SERIALIZATION__COLUMNAR_HPP
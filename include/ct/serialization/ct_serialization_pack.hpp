@@ -4,11 +4,11 @@
 #include "ct/serialization/utils/ct_serialization_utils.hpp"
 
 #include "ct/utils/typelist/ct_utils_typelist_to_tuple.hpp"
-#include "ct/utils/typelist/ct_utils_typelist_first_types.hpp"
 
 //#include <iostream> // FIXME: for debug
 
 #include <cstring> // for std::memcpy()
+#include <iterator> // for std::iterator_traits<T>
 
 namespace ct {
 
@@ -43,6 +43,11 @@ namespace serialization {
     } // namespace serialization
     } // namespace ct
     @endcode
+
+    @note Scalar values must be copied by using
+    `ct::utils::byte_order_utils< info_t::policy_t::order >::store<T>()` instead
+    of raw `std::memcpy()`, to respect byte order policy (and to keep packing
+    usable in constant expressions).
 */
 
 /**
@@ -174,6 +179,9 @@ struct packer_trait
         Unfortunately, due to usage of `std::memcpy()` (which, is not constexpr
         function in c++11), we cannot mark all that recursive `pack()` functions
         like `constexpr` too :C
+
+        Since C++20 it is possible by `std::bit_cast()` - so all of them marked
+        as `CT_CONSTEXPR_PACKING` (which is `constexpr` only if supported).
     */
     template <typename T, typename Enabled = void>
     struct specialized_for {};
@@ -190,15 +198,18 @@ struct packer_trait<Types...>::specialized_for<T, typename std::enable_if< std::
     using value_t = T;
 
     template <std::size_t OFFSET_IDX>
-    static void pack(byte_t* dest, const value_t& value)
+    static CT_CONSTEXPR_PACKING void pack(byte_t* dest, const value_t& value)
     {
         // std::cout << "pack <    T>: offset_idx= " << OFFSET_IDX << " value=" << value << std::endl;
 
         constexpr std::size_t OFFSET = std::get<OFFSET_IDX>( info_t::get_offsets() );
-        std::memcpy( (dest + OFFSET), &value, sizeof(T) );
+        ct::utils::byte_order_utils< info_t::policy_t::order >::template store<T>( (dest + OFFSET), &value, 1 );
     }
 };
 
+template <typename ... Types>
+struct values_packer;
+
 namespace impl {
 
 // Utility/common implementation for array types
@@ -209,7 +220,7 @@ struct same_items_packer
     using byte_t = typename info_t::byte_t;
 
     template <std::size_t OFFSET_IDX, typename T, std::size_t COUNT>
-    static auto pack_scalar_array(byte_t* dest, const T* items)
+    static CT_CONSTEXPR_PACKING auto pack_scalar_array(byte_t* dest, const T* items)
         -> typename std::enable_if< std::is_scalar<T>::value, void>::type
     {
         // std::cout << "pack <array>: offset_idx= " << OFFSET_IDX << " values= [";
@@ -219,17 +230,71 @@ struct same_items_packer
         // std::cout << ']' << std::endl;
 
         constexpr std::size_t OFFSET = std::get<OFFSET_IDX>( info_t::get_offsets() );
-        std::memcpy( (dest + OFFSET), items, (COUNT * sizeof(T)) );
+        ct::utils::byte_order_utils< info_t::policy_t::order >::template store<T>( (dest + OFFSET), items, COUNT );
     }
 
     template <std::size_t OFFSET_IDX, typename T, std::size_t SIZE, int ... Indexes>
-    static void pack_non_scalar_array(byte_t* dest, const T* item, ct::ind_seq::index<Indexes...>)
+    static CT_CONSTEXPR_PACKING void pack_non_scalar_array(byte_t* dest, const T* item, ct::ind_seq::index<Indexes...>)
     {
         using dummy_t = int[];
         (void) dummy_t {
             ( packer_trait<Types...>::template specialized_for<T>::template pack<OFFSET_IDX + (Indexes * utils::get_memcpy_values_count<T>()) >(dest, item[Indexes]), /* for making dummy_t: */ 0) ...
         };
     }
+
+    // Arrays, which are too big for unrolling (see CT_ARRAY_UNROLL_THRESHOLD):
+    // single flattened value, items are packed densely by runtime loop - each
+    // by its own offsets (packed layout, the same byte order)
+    template <std::size_t OFFSET_IDX, typename T, std::size_t SIZE>
+    static CT_CONSTEXPR_PACKING void pack_looped_array(byte_t* dest, const T* items)
+    {
+        constexpr std::size_t OFFSET = std::get<OFFSET_IDX>( info_t::get_offsets() );
+        pack_looped_items<T>( (dest + OFFSET), items, SIZE, std::integral_constant<bool, ct::is_packed_aggregate<T>::value>{} );
+    }
+
+    template <typename T>
+    static CT_CONSTEXPR_PACKING void pack_looped_items(byte_t* dest, const T* items, std::size_t count, std::false_type /* is_packed_aggregate */)
+    {
+        using item_packer_t = values_packer< with_policy< policy< info_t::policy_t::order >, T > >;
+
+        constexpr std::size_t STRIDE = ct::get_bytes_count<T>();
+
+        for (std::size_t i = 0; i < count; ++i) {
+            item_packer_t::template pack_values<0>( (dest + (i * STRIDE)), items[i] );
+        }
+    }
+
+#if CT_HAS_AGGREGATE_DECOMPOSITION
+    template <typename T>
+    static CT_CONSTEXPR_PACKING void pack_looped_items(byte_t* dest, const T* items, std::size_t count, std::true_type /* is_packed_aggregate */)
+    {
+        pack_packed_aggregates<T>(dest, items, count);
+    }
+
+    // Aggregates without padding (see ct::is_packed_aggregate<T>): bytes in
+    // memory are the same as packed bytes, so with native byte order all items
+    // are copied by single std::memcpy(). Otherwise - field-by-field
+    template <typename T>
+    static CT_CONSTEXPR_PACKING void pack_packed_aggregates(byte_t* dest, const T* items, std::size_t count)
+    {
+        if constexpr (ct::utils::byte_order_utils< info_t::policy_t::order >::is_native) {
+#if CT_HAS_CONSTEXPR_PACKING
+            if(!std::is_constant_evaluated())
+#endif
+            {
+                std::memcpy(dest, items, count * sizeof(T));
+                return;
+            }
+        }
+
+        for (std::size_t i = 0; i < count; ++i) {
+            ct::aggregate_trait<T>::apply(items[i], [dest, i](const auto& ... fields) {
+                using fields_packer_t = values_packer< with_policy< policy< info_t::policy_t::order >, typename std::remove_cv< typename std::remove_reference<decltype(fields)>::type >::type ... > >;
+                fields_packer_t::template pack_values<0>( (dest + (i * sizeof(T))), fields... );
+            });
+        }
+    }
+#endif // CT_HAS_AGGREGATE_DECOMPOSITION
 };
 
 } // namespace impl
@@ -245,7 +310,7 @@ struct packer_trait<Types...>::specialized_for< std::array<T, SIZE>, typename st
     using value_t = std::array<T, SIZE>;
 
     template <std::size_t OFFSET_IDX>
-    static void pack(byte_t* dest, const value_t& array)
+    static CT_CONSTEXPR_PACKING void pack(byte_t* dest, const value_t& array)
     {
         impl::same_items_packer<Types...>::template pack_scalar_array<OFFSET_IDX, T, SIZE>(dest, array.data());
     }
@@ -262,16 +327,16 @@ struct packer_trait<Types...>::specialized_for< T[SIZE], typename std::enable_if
     using value_t = T[SIZE];
 
     template <std::size_t OFFSET_IDX>
-    static void pack(byte_t* dest, const value_t& array)
+    static CT_CONSTEXPR_PACKING void pack(byte_t* dest, const value_t& array)
     {
-        impl::same_items_packer<Types...>::template pack_scalar_array<OFFSET_IDX, T, SIZE>(dest, &array, ct::ind_seq::gen_seq<SIZE>{});
+        impl::same_items_packer<Types...>::template pack_scalar_array<OFFSET_IDX, T, SIZE>(dest, array);
     }
 };
 
 // Specialization for: std::array with non-scalar types
 template<typename ... Types>
 template<typename T, std::size_t SIZE>
-struct packer_trait<Types...>::specialized_for< std::array<T, SIZE>, typename std::enable_if< std::is_scalar<T>::value == false >::type>
+struct packer_trait<Types...>::specialized_for< std::array<T, SIZE>, typename std::enable_if< (std::is_scalar<T>::value == false) && (ct::is_looped_array< std::array<T, SIZE> >::value == false) >::type>
 {
     using info_t = packer_trait<Types...>::info_t;
     using byte_t = typename info_t::byte_t;
@@ -279,16 +344,50 @@ struct packer_trait<Types...>::specialized_for< std::array<T, SIZE>, typename st
     using value_t = std::array<T, SIZE>;
 
     template <std::size_t OFFSET_IDX>
-    static void pack(byte_t* dest, const value_t& array)
+    static CT_CONSTEXPR_PACKING void pack(byte_t* dest, const value_t& array)
     {
         impl::same_items_packer<Types...>::template pack_non_scalar_array<OFFSET_IDX, T, SIZE>(dest, array.data(), ct::ind_seq::gen_seq<SIZE>{});
     }
 };
 
+// Specialization for: std::array with non-scalar types, too big for unrolling
+template<typename ... Types>
+template<typename T, std::size_t SIZE>
+struct packer_trait<Types...>::specialized_for< std::array<T, SIZE>, typename std::enable_if< ct::is_looped_array< std::array<T, SIZE> >::value == true >::type>
+{
+    using info_t = packer_trait<Types...>::info_t;
+    using byte_t = typename info_t::byte_t;
+
+    using value_t = std::array<T, SIZE>;
+
+    template <std::size_t OFFSET_IDX>
+    static CT_CONSTEXPR_PACKING void pack(byte_t* dest, const value_t& array)
+    {
+        impl::same_items_packer<Types...>::template pack_looped_array<OFFSET_IDX, T, SIZE>(dest, array.data());
+    }
+};
+
 // Specialization for: raw array with no-scalar types
 template<typename ... Types>
 template<typename T, std::size_t SIZE>
-struct packer_trait<Types...>::specialized_for< T[SIZE], typename std::enable_if< std::is_scalar<T>::value == false >::type>
+struct packer_trait<Types...>::specialized_for< T[SIZE], typename std::enable_if< (std::is_scalar<T>::value == false) && (ct::is_looped_array< T[SIZE] >::value == false) >::type>
+{
+    using info_t = packer_trait<Types...>::info_t;
+    using byte_t = typename info_t::byte_t;
+
+    using value_t = T[SIZE];
+
+    template <std::size_t OFFSET_IDX>
+    static CT_CONSTEXPR_PACKING void pack(byte_t* dest, const value_t& array)
+    {
+        impl::same_items_packer<Types...>::template pack_non_scalar_array<OFFSET_IDX, T, SIZE>(dest, array, ct::ind_seq::gen_seq<SIZE>{});
+    }
+};
+
+// Specialization for: raw array with non-scalar types, too big for unrolling
+template<typename ... Types>
+template<typename T, std::size_t SIZE>
+struct packer_trait<Types...>::specialized_for< T[SIZE], typename std::enable_if< ct::is_looped_array< T[SIZE] >::value == true >::type>
 {
     using info_t = packer_trait<Types...>::info_t;
     using byte_t = typename info_t::byte_t;
@@ -296,12 +395,54 @@ struct packer_trait<Types...>::specialized_for< T[SIZE], typename std::enable_if
     using value_t = T[SIZE];
 
     template <std::size_t OFFSET_IDX>
-    static void pack(byte_t* dest, const value_t& array)
+    static CT_CONSTEXPR_PACKING void pack(byte_t* dest, const value_t& array)
     {
-        impl::same_items_packer<Types...>::template pack_non_scalar_array<OFFSET_IDX, T, SIZE>(dest, &array, ct::ind_seq::gen_seq<SIZE>{});
+        impl::same_items_packer<Types...>::template pack_looped_array<OFFSET_IDX, T, SIZE>(dest, array);
     }
 };
 
+#if CT_HAS_AGGREGATE_DECOMPOSITION
+
+// Specialization for: plain aggregate without padding - single value
+template<typename ... Types>
+template<typename T>
+struct packer_trait<Types...>::specialized_for< T, typename std::enable_if< ct::is_packed_aggregate<T>::value == true >::type>
+{
+    using info_t = packer_trait<Types...>::info_t;
+    using byte_t = typename info_t::byte_t;
+
+    using value_t = T;
+
+    template <std::size_t OFFSET_IDX>
+    static CT_CONSTEXPR_PACKING void pack(byte_t* dest, const value_t& value)
+    {
+        constexpr std::size_t OFFSET = std::get<OFFSET_IDX>( info_t::get_offsets() );
+        impl::same_items_packer<Types...>::template pack_packed_aggregates<T>( (dest + OFFSET), &value, 1 );
+    }
+};
+
+// Specialization for: plain aggregate with padding - the same as std::tuple of
+// its fields
+template<typename ... Types>
+template<typename T>
+struct packer_trait<Types...>::specialized_for< T, typename std::enable_if< ct::is_decomposable_aggregate<T>::value && (ct::is_packed_aggregate<T>::value == false) >::type>
+{
+    using info_t = packer_trait<Types...>::info_t;
+    using byte_t = typename info_t::byte_t;
+
+    using value_t = T;
+
+    template <std::size_t OFFSET_IDX>
+    static CT_CONSTEXPR_PACKING void pack(byte_t* dest, const value_t& value)
+    {
+        ct::aggregate_trait<T>::apply(value, [dest](const auto& ... fields) {
+            values_packer<Types...>::template pack_values<OFFSET_IDX>(dest, fields...);
+        });
+    }
+};
+
+#endif // CT_HAS_AGGREGATE_DECOMPOSITION
+
 // -----------------------------------------------------------------------------
 
 // Specialization for: std::pair
@@ -315,7 +456,7 @@ struct packer_trait<Types...>::specialized_for< std::pair<First, Second> >
     using value_t = std::pair<First, Second>;
 
     template <std::size_t OFFSET_IDX>
-    static void pack(byte_t* dest, const value_t& pair)
+    static CT_CONSTEXPR_PACKING void pack(byte_t* dest, const value_t& pair)
     {
         // std::cout << "<T,T> pair: left:  offset_idx= " << OFFSET_IDX << " + " << 0 << std::endl;
         packer_trait<Types...>::template specialized_for<First >::template pack<OFFSET_IDX +                              0>(dest, pair.first);
@@ -336,12 +477,12 @@ struct values_packer
     using byte_t = typename info_t::byte_t;
 
     template <std::size_t OFFSET_IDX, typename ... Args, int ... Indexes>
-    static void pack_values_impl(byte_t* dest, const Args& ... values, ct::ind_seq::index<Indexes...>)
+    static CT_CONSTEXPR_PACKING void pack_values_impl(byte_t* dest, const Args& ... values, ct::ind_seq::index<Indexes...>)
     {
         using dummy_t = int[];
         (void) dummy_t {
             ( packer_trait<Types...>::template specialized_for<Args>::template pack
-              <OFFSET_IDX + ( Indexes == 0 ? 0 :
+              <OFFSET_IDX +
                /*
                    Graphical description of per-item offsets calculation logic:
 
@@ -369,31 +510,43 @@ struct values_packer
                                                      Arg ItemValue = values[ItemIdx];
 
 
-                       < i32, <i64, i16> > <-- types before ItemIdx (first_types<ItemIdx==2>)
+                       < i32, <i64, i16> > <-- types before ItemIdx
                        ^^^^^^^^^^^^^^^^^^^
                                 |
                                 +-- items count = 3
 
+                       [   1,          2,                3 ] <-- items counts of each of <Args...>
+                       [   0,          1,                3 ] <-- their prefix sum (calculated once for all <Args...>)
+
                    ------------------------------------------------------------
 
                    So, for ItemIdx==2 --> Offset = Flattened_Offsets[3] = 12
 
                    Yes... I know how strange it is look :D
                */
-               (utils::get_memcpy_values_count<
-                    typename ct::utils::list_to_tuple< typename ct::utils::first_types<Indexes, ct::utils::List<Args...>>::type >::type
-               >())
-            )>(dest, /* Item= */ values), /* for making dummy_t: */ 0) ...
+               utils::get_memcpy_values_offset<Indexes, Args...>()
+            >(dest, /* Item= */ values), /* for making dummy_t: */ 0) ...
         };
     }
 
     template <std::size_t OFFSET_IDX, typename ... Args>
-    static void pack_values(byte_t* dest, const Args& ... values)
+    static CT_CONSTEXPR_PACKING void pack_values(byte_t* dest, const Args& ... values)
     {
         constexpr std::size_t ARGS_COUNT = sizeof...(Args);
         pack_values_impl<OFFSET_IDX, Args...>(dest, values..., ct::ind_seq::gen_seq<ARGS_COUNT>{});
     }
 
+    // Zeroes padding of record (gaps between fields of aligned & reordered
+    // layouts), so packed bytes don't depend on previous buffer contents. Must
+    // be called before packing of values. For packed layout - does nothing
+    static CT_CONSTEXPR_PACKING void clear_padding(byte_t* dest)
+    {
+        if(info_t::policy_t::layout != fields_layout::packed) {
+            for(std::size_t i = 0; i < info_t::bytes_count; ++i) {
+                dest[i] = 0;
+            }
+        }
+    }
 };
 
 // Specialization for: std::tuple
@@ -407,13 +560,13 @@ struct packer_trait<Types...>::specialized_for< std::tuple<TupleTypes...> >
     using value_t = std::tuple<TupleTypes...>;
 
     template <std::size_t OFFSET_IDX, int ... Indexes>
-    static void pack_tuple_impl(byte_t* dest, const value_t& tuple, ct::ind_seq::index<Indexes...>)
+    static CT_CONSTEXPR_PACKING void pack_tuple_impl(byte_t* dest, const value_t& tuple, ct::ind_seq::index<Indexes...>)
     {
         values_packer<Types...>::template pack_values<OFFSET_IDX>(dest, /* unpack tuple items: */ std::get<Indexes>(tuple) ...);
     }
 
     template <std::size_t OFFSET_IDX>
-    static void pack(byte_t* dest, const value_t& tuple)
+    static CT_CONSTEXPR_PACKING void pack(byte_t* dest, const value_t& tuple)
     {
         constexpr std::size_t TUPLE_ITEMS_COUNT = sizeof...(TupleTypes);
         pack_tuple_impl<OFFSET_IDX>(dest, tuple, ct::ind_seq::gen_seq<TUPLE_ITEMS_COUNT>{});
@@ -424,13 +577,14 @@ struct packer_trait<Types...>::specialized_for< std::tuple<TupleTypes...> >
 // Convenient functon with implicit automatic types deduction
 
 template <typename ... Args>
-inline void pack_into(typename values_packer<Args...>::byte_t* bytes, const Args& ... args)
+inline CT_CONSTEXPR_PACKING void pack_into(typename values_packer<Args...>::byte_t* bytes, const Args& ... args)
 {
+    values_packer<Args...>::clear_padding(bytes);
     values_packer<Args...>::template pack_values<0>(bytes, args...);
 }
 
 template <typename ... Args>
-inline auto pack(const Args& ... args)
+inline CT_CONSTEXPR_PACKING auto pack(const Args& ... args)
     -> typename values_packer<Args...>::info_t::byte_buffer_t
 {
     using byte_buffer_t = typename values_packer<Args...>::info_t::byte_buffer_t; // Shortcut
@@ -440,6 +594,68 @@ inline auto pack(const Args& ... args)
     return bytes;
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// The same, but with explicitly specified policy (for example - byte order)
+
+template <typename Policy, typename ... Args>
+inline CT_CONSTEXPR_PACKING void pack_into_with(typename values_packer< with_policy<Policy, Args...> >::byte_t* bytes, const Args& ... args)
+{
+    using packer_t = values_packer< with_policy<Policy, Args...> >; // Shortcut
+
+    packer_t::clear_padding(bytes);
+    packer_t::template pack_values<0>(bytes, args...);
+}
+
+template <typename Policy, typename ... Args>
+inline CT_CONSTEXPR_PACKING auto pack_with(const Args& ... args)
+    -> typename values_packer< with_policy<Policy, Args...> >::info_t::byte_buffer_t
+{
+    using byte_buffer_t = typename values_packer< with_policy<Policy, Args...> >::info_t::byte_buffer_t; // Shortcut
+
+    byte_buffer_t bytes;
+    pack_into_with<Policy>(bytes.data(), args...);
+    return bytes;
+}
+
+// -----------------------------------------------------------------------------
+// Batch packing of same-typed records
+
+/**
+    Packs records range `[first, last)` one after another, into continuous
+    bytes buffer. Each record takes exactly `packed_bytes_count<record_t>()`
+    bytes, so the stride between records is compile-time constant, and the
+    whole loop body (all offsets inside record) is known to the compiler -
+    which gives it a chance to unroll & vectorize across records.
+
+    @code{.cpp}
+    using record_t = std::tuple<std::uint32_t, float, std::array<std::int16_t, 3>>;
+    std::vector<record_t> records = { ... };
+
+    std::vector<std::int8_t> bytes( records.size() * ct::serialization::packed_bytes_count<record_t>() );
+    ct::serialization::pack_range(bytes.data(), records.begin(), records.end());
+    @endcode
+
+    @return Count of written bytes
+*/
+template <typename InputIt,
+
+          // Deduced types
+          typename record_t = typename std::iterator_traits<InputIt>::value_type,
+          typename packer_t = values_packer<record_t>
+          >
+inline std::size_t pack_range(typename packer_t::byte_t* dest, InputIt first, InputIt last)
+{
+    constexpr std::size_t STRIDE = packer_t::info_t::bytes_count; // same as packed_bytes_count<record_t>()
+
+    std::size_t bytes_count = 0;
+    for(; first != last; ++first, bytes_count += STRIDE) {
+        packer_t::clear_padding(dest + bytes_count);
+        packer_t::template pack_values<0>(dest + bytes_count, *first);
+    }
+
+    return bytes_count;
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 // Convenient shortcuts
 
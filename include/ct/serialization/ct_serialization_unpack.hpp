@@ -2,11 +2,12 @@
 #define CT__SERIALIZATION__UNPACK_HPP
 
 #include "ct/serialization/utils/ct_serialization_utils.hpp"
+#include "ct/serialization/utils/ct_serialization_utils_prefetch.hpp"
 
 #include "ct/utils/typelist/ct_utils_typelist_to_tuple.hpp"
-#include "ct/utils/typelist/ct_utils_typelist_first_types.hpp"
 
 #include <cstring> // for std::memcpy()
+#include <iterator> // for std::iterator_traits<T>
 
 namespace ct {
 
@@ -44,6 +45,9 @@ namespace serialization {
     } // namespace serialization
     } // namespace ct
     @endcode
+
+    @note Scalar values must be copied by using
+    `ct::utils::byte_order_utils< info_t::policy_t::order >::load<T>()`.
 */
 
 template <typename ... Types>
@@ -59,6 +63,9 @@ struct unpacker_trait
         Unfortunately, due to usage of `std::memcpy()` (which, is not constexpr
         function in c++11), we cannot mark all that recursive `unpack()` functions
         like `constexpr` too :C
+
+        Since C++20 it is possible by `std::bit_cast()` - so all of them marked
+        as `CT_CONSTEXPR_PACKING` (which is `constexpr` only if supported).
     */
     template <typename T, typename Enabled = void>
     struct specialized_for {};
@@ -75,13 +82,16 @@ struct unpacker_trait<Types...>::specialized_for<T, typename std::enable_if< std
     using value_t = T;
 
     template <std::size_t OFFSET_IDX>
-    static void unpack(const byte_t* src, value_t& value)
+    static CT_CONSTEXPR_PACKING void unpack(const byte_t* src, value_t& value)
     {
         constexpr std::size_t OFFSET = std::get<OFFSET_IDX>( info_t::get_offsets() );
-        std::memcpy(&value, (src + OFFSET), sizeof(T) );
+        ct::utils::byte_order_utils< info_t::policy_t::order >::template load<T>( &value, (src + OFFSET), 1 );
     }
 };
 
+template <typename ... Types>
+struct values_unpacker;
+
 namespace impl {
 
 // Utility/common implementation for array types
@@ -92,21 +102,73 @@ struct same_items_unpacker
     using byte_t = typename info_t::byte_t;
 
     template <std::size_t OFFSET_IDX, typename T, std::size_t COUNT>
-    static auto unpack_scalar_array(const byte_t* src, T* items)
+    static CT_CONSTEXPR_PACKING auto unpack_scalar_array(const byte_t* src, T* items)
         -> typename std::enable_if< std::is_scalar<T>::value, void>::type
     {
         constexpr std::size_t OFFSET = std::get<OFFSET_IDX>( info_t::get_offsets() );
-        std::memcpy(items, (src + OFFSET), (COUNT * sizeof(T)) );
+        ct::utils::byte_order_utils< info_t::policy_t::order >::template load<T>( items, (src + OFFSET), COUNT );
     }
 
     template <std::size_t OFFSET_IDX, typename T, std::size_t SIZE, int ... Indexes>
-    static void unpack_non_scalar_array(const byte_t* src, T* item, ct::ind_seq::index<Indexes...>)
+    static CT_CONSTEXPR_PACKING void unpack_non_scalar_array(const byte_t* src, T* item, ct::ind_seq::index<Indexes...>)
     {
         using dummy_t = int[];
         (void) dummy_t {
             ( unpacker_trait<Types...>::template specialized_for<T>::template unpack<OFFSET_IDX + (Indexes * utils::get_memcpy_values_count<T>()) >(src, item[Indexes]), /* for making dummy_t: */ 0) ...
         };
     }
+
+    // Arrays, which are too big for unrolling (see CT_ARRAY_UNROLL_THRESHOLD):
+    // single flattened value, items are unpacked densely by runtime loop - each
+    // by its own offsets (packed layout, the same byte order)
+    template <std::size_t OFFSET_IDX, typename T, std::size_t SIZE>
+    static CT_CONSTEXPR_PACKING void unpack_looped_array(const byte_t* src, T* items)
+    {
+        constexpr std::size_t OFFSET = std::get<OFFSET_IDX>( info_t::get_offsets() );
+        unpack_looped_items<T>( (src + OFFSET), items, SIZE, std::integral_constant<bool, ct::is_packed_aggregate<T>::value>{} );
+    }
+
+    template <typename T>
+    static CT_CONSTEXPR_PACKING void unpack_looped_items(const byte_t* src, T* items, std::size_t count, std::false_type /* is_packed_aggregate */)
+    {
+        using item_unpacker_t = values_unpacker< with_policy< policy< info_t::policy_t::order >, T > >;
+
+        constexpr std::size_t STRIDE = ct::get_bytes_count<T>();
+
+        for (std::size_t i = 0; i < count; ++i) {
+            item_unpacker_t::template unpack_values<0>( (src + (i * STRIDE)), items[i] );
+        }
+    }
+
+#if CT_HAS_AGGREGATE_DECOMPOSITION
+    template <typename T>
+    static CT_CONSTEXPR_PACKING void unpack_looped_items(const byte_t* src, T* items, std::size_t count, std::true_type /* is_packed_aggregate */)
+    {
+        unpack_packed_aggregates<T>(src, items, count);
+    }
+
+    // Mirror of same_items_packer::pack_packed_aggregates()
+    template <typename T>
+    static CT_CONSTEXPR_PACKING void unpack_packed_aggregates(const byte_t* src, T* items, std::size_t count)
+    {
+        if constexpr (ct::utils::byte_order_utils< info_t::policy_t::order >::is_native) {
+#if CT_HAS_CONSTEXPR_PACKING
+            if(!std::is_constant_evaluated())
+#endif
+            {
+                std::memcpy(items, src, count * sizeof(T));
+                return;
+            }
+        }
+
+        for (std::size_t i = 0; i < count; ++i) {
+            ct::aggregate_trait<T>::apply(items[i], [src, i](auto& ... fields) {
+                using fields_unpacker_t = values_unpacker< with_policy< policy< info_t::policy_t::order >, typename std::remove_reference<decltype(fields)>::type ... > >;
+                fields_unpacker_t::template unpack_values<0>( (src + (i * sizeof(T))), fields... );
+            });
+        }
+    }
+#endif // CT_HAS_AGGREGATE_DECOMPOSITION
 };
 
 } // namespace impl
@@ -122,7 +184,7 @@ struct unpacker_trait<Types...>::specialized_for< std::array<T, SIZE>, typename
     using value_t = std::array<T, SIZE>;
 
     template <std::size_t OFFSET_IDX>
-    static void unpack(const byte_t* src, value_t& array)
+    static CT_CONSTEXPR_PACKING void unpack(const byte_t* src, value_t& array)
     {
         impl::same_items_unpacker<Types...>::template unpack_scalar_array<OFFSET_IDX, T, SIZE>(src, array.data());
     }
@@ -139,16 +201,16 @@ struct unpacker_trait<Types...>::specialized_for< T[SIZE], typename std::enable_
     using value_t = T[SIZE];
 
     template <std::size_t OFFSET_IDX>
-    static void unpack(const byte_t* src, value_t& array)
+    static CT_CONSTEXPR_PACKING void unpack(const byte_t* src, value_t& array)
     {
-        impl::same_items_unpacker<Types...>::template unpack_scalar_array<OFFSET_IDX, T, SIZE>(src, &array, ct::ind_seq::gen_seq<SIZE>{});
+        impl::same_items_unpacker<Types...>::template unpack_scalar_array<OFFSET_IDX, T, SIZE>(src, array);
     }
 };
 
 // Specialization for: std::array with non-scalar types
 template<typename ... Types>
 template<typename T, std::size_t SIZE>
-struct unpacker_trait<Types...>::specialized_for< std::array<T, SIZE>, typename std::enable_if< std::is_scalar<T>::value == false >::type>
+struct unpacker_trait<Types...>::specialized_for< std::array<T, SIZE>, typename std::enable_if< (std::is_scalar<T>::value == false) && (ct::is_looped_array< std::array<T, SIZE> >::value == false) >::type>
 {
     using info_t = unpacker_trait<Types...>::info_t;
     using byte_t = typename info_t::byte_t;
@@ -156,16 +218,50 @@ struct unpacker_trait<Types...>::specialized_for< std::array<T, SIZE>, typename
     using value_t = std::array<T, SIZE>;
 
     template <std::size_t OFFSET_IDX>
-    static void unpack(const byte_t* src, value_t& array)
+    static CT_CONSTEXPR_PACKING void unpack(const byte_t* src, value_t& array)
     {
         impl::same_items_unpacker<Types...>::template unpack_non_scalar_array<OFFSET_IDX, T, SIZE>(src, array.data(), ct::ind_seq::gen_seq<SIZE>{});
     }
 };
 
+// Specialization for: std::array with non-scalar types, too big for unrolling
+template<typename ... Types>
+template<typename T, std::size_t SIZE>
+struct unpacker_trait<Types...>::specialized_for< std::array<T, SIZE>, typename std::enable_if< ct::is_looped_array< std::array<T, SIZE> >::value == true >::type>
+{
+    using info_t = unpacker_trait<Types...>::info_t;
+    using byte_t = typename info_t::byte_t;
+
+    using value_t = std::array<T, SIZE>;
+
+    template <std::size_t OFFSET_IDX>
+    static CT_CONSTEXPR_PACKING void unpack(const byte_t* src, value_t& array)
+    {
+        impl::same_items_unpacker<Types...>::template unpack_looped_array<OFFSET_IDX, T, SIZE>(src, array.data());
+    }
+};
+
 // Specialization for: raw array with no-scalar types
 template<typename ... Types>
 template<typename T, std::size_t SIZE>
-struct unpacker_trait<Types...>::specialized_for< T[SIZE], typename std::enable_if< std::is_scalar<T>::value == false >::type>
+struct unpacker_trait<Types...>::specialized_for< T[SIZE], typename std::enable_if< (std::is_scalar<T>::value == false) && (ct::is_looped_array< T[SIZE] >::value == false) >::type>
+{
+    using info_t = unpacker_trait<Types...>::info_t;
+    using byte_t = typename info_t::byte_t;
+
+    using value_t = T[SIZE];
+
+    template <std::size_t OFFSET_IDX>
+    static CT_CONSTEXPR_PACKING void unpack(const byte_t* src, value_t& array)
+    {
+        impl::same_items_unpacker<Types...>::template unpack_non_scalar_array<OFFSET_IDX, T, SIZE>(src, array, ct::ind_seq::gen_seq<SIZE>{});
+    }
+};
+
+// Specialization for: raw array with non-scalar types, too big for unrolling
+template<typename ... Types>
+template<typename T, std::size_t SIZE>
+struct unpacker_trait<Types...>::specialized_for< T[SIZE], typename std::enable_if< ct::is_looped_array< T[SIZE] >::value == true >::type>
 {
     using info_t = unpacker_trait<Types...>::info_t;
     using byte_t = typename info_t::byte_t;
@@ -173,12 +269,54 @@ struct unpacker_trait<Types...>::specialized_for< T[SIZE], typename std::enable_
     using value_t = T[SIZE];
 
     template <std::size_t OFFSET_IDX>
-    static void unpack(const byte_t* src, value_t& array)
+    static CT_CONSTEXPR_PACKING void unpack(const byte_t* src, value_t& array)
     {
-        impl::same_items_unpacker<Types...>::template unpack_non_scalar_array<OFFSET_IDX, T, SIZE>(src, &array, ct::ind_seq::gen_seq<SIZE>{});
+        impl::same_items_unpacker<Types...>::template unpack_looped_array<OFFSET_IDX, T, SIZE>(src, array);
     }
 };
 
+#if CT_HAS_AGGREGATE_DECOMPOSITION
+
+// Specialization for: plain aggregate without padding - single value
+template<typename ... Types>
+template<typename T>
+struct unpacker_trait<Types...>::specialized_for< T, typename std::enable_if< ct::is_packed_aggregate<T>::value == true >::type>
+{
+    using info_t = unpacker_trait<Types...>::info_t;
+    using byte_t = typename info_t::byte_t;
+
+    using value_t = T;
+
+    template <std::size_t OFFSET_IDX>
+    static CT_CONSTEXPR_PACKING void unpack(const byte_t* src, value_t& value)
+    {
+        constexpr std::size_t OFFSET = std::get<OFFSET_IDX>( info_t::get_offsets() );
+        impl::same_items_unpacker<Types...>::template unpack_packed_aggregates<T>( (src + OFFSET), &value, 1 );
+    }
+};
+
+// Specialization for: plain aggregate with padding - the same as std::tuple of
+// its fields
+template<typename ... Types>
+template<typename T>
+struct unpacker_trait<Types...>::specialized_for< T, typename std::enable_if< ct::is_decomposable_aggregate<T>::value && (ct::is_packed_aggregate<T>::value == false) >::type>
+{
+    using info_t = unpacker_trait<Types...>::info_t;
+    using byte_t = typename info_t::byte_t;
+
+    using value_t = T;
+
+    template <std::size_t OFFSET_IDX>
+    static CT_CONSTEXPR_PACKING void unpack(const byte_t* src, value_t& value)
+    {
+        ct::aggregate_trait<T>::apply(value, [src](auto& ... fields) {
+            values_unpacker<Types...>::template unpack_values<OFFSET_IDX>(src, fields...);
+        });
+    }
+};
+
+#endif // CT_HAS_AGGREGATE_DECOMPOSITION
+
 // -----------------------------------------------------------------------------
 
 // Specialization for: std::pair
@@ -192,7 +330,7 @@ struct unpacker_trait<Types...>::specialized_for< std::pair<First, Second> >
     using value_t = std::pair<First, Second>;
 
     template <std::size_t OFFSET_IDX>
-    static void unpack(const byte_t* src, value_t& pair)
+    static CT_CONSTEXPR_PACKING void unpack(const byte_t* src, value_t& pair)
     {
         unpacker_trait<Types...>::template specialized_for<First >::template unpack<OFFSET_IDX +                              0>(src, pair.first);
         unpacker_trait<Types...>::template specialized_for<Second>::template unpack<OFFSET_IDX + utils::get_memcpy_values_count<First>()>(src, pair.second);
@@ -210,22 +348,20 @@ struct values_unpacker
     using byte_t = typename info_t::byte_t;
 
     template <std::size_t OFFSET_IDX, typename ... Args, int ... Indexes>
-    static void unpack_values_impl(const byte_t* src, Args& ... values, ct::ind_seq::index<Indexes...>)
+    static CT_CONSTEXPR_PACKING void unpack_values_impl(const byte_t* src, Args& ... values, ct::ind_seq::index<Indexes...>)
     {
         using dummy_t = int[];
         (void) dummy_t {
             ( unpacker_trait<Types...>::template specialized_for<Args>::template unpack
-              <OFFSET_IDX + ( Indexes == 0 ? 0 :
+              <OFFSET_IDX +
                    // See description of it inside similar packer trait :)
-                   (utils::get_memcpy_values_count<
-                        typename ct::utils::list_to_tuple< typename ct::utils::first_types<Indexes, ct::utils::List<Args...>>::type >::type
-                   >())
-              )>(src, /* Item= */ values), /* for making dummy_t: */ 0) ...
+                   utils::get_memcpy_values_offset<Indexes, Args...>()
+              >(src, /* Item= */ values), /* for making dummy_t: */ 0) ...
         };
     }
 
     template <std::size_t OFFSET_IDX, typename ... Args>
-    static void unpack_values(const byte_t* src, Args& ... values)
+    static CT_CONSTEXPR_PACKING void unpack_values(const byte_t* src, Args& ... values)
     {
         constexpr std::size_t ARGS_COUNT = sizeof...(Args);
         unpack_values_impl<OFFSET_IDX, Args...>(src, values..., ct::ind_seq::gen_seq<ARGS_COUNT>{});
@@ -244,13 +380,13 @@ struct unpacker_trait<Types...>::specialized_for< std::tuple<TupleTypes...> >
     using value_t = std::tuple<TupleTypes...>;
 
     template <std::size_t OFFSET_IDX, int ... Indexes>
-    static void unpack_tuple_impl(const byte_t* src, value_t& tuple, ct::ind_seq::index<Indexes...>)
+    static CT_CONSTEXPR_PACKING void unpack_tuple_impl(const byte_t* src, value_t& tuple, ct::ind_seq::index<Indexes...>)
     {
         values_unpacker<Types...>::template unpack_values<OFFSET_IDX>(src, /* unpack tuple items: */ std::get<Indexes>(tuple) ...);
     }
 
     template <std::size_t OFFSET_IDX>
-    static void unpack(const byte_t* src, value_t& tuple)
+    static CT_CONSTEXPR_PACKING void unpack(const byte_t* src, value_t& tuple)
     {
         constexpr std::size_t TUPLE_ITEMS_COUNT = sizeof...(TupleTypes);
         unpack_tuple_impl<OFFSET_IDX>(src, tuple, ct::ind_seq::gen_seq<TUPLE_ITEMS_COUNT>{});
@@ -265,7 +401,7 @@ template <typename ... Args,
           // Deduced types
           typename unpacker_t = values_unpacker<Args...>,
           typename byte_t = typename unpacker_t::byte_t>
-inline void unpack_from(const byte_t* bytes, Args& ... args)
+inline CT_CONSTEXPR_PACKING void unpack_from(const byte_t* bytes, Args& ... args)
 {
     unpacker_t::template unpack_values<0>(bytes, args...);
 }
@@ -276,11 +412,35 @@ template <typename ... Args,
           typename unpacker_t = values_unpacker<Args...>,
           typename byte_buffer_t = typename unpacker_t::byte_buffer_t
           >
-inline void unpack(const byte_buffer_t& buffer, Args& ... args)
+inline CT_CONSTEXPR_PACKING void unpack(const byte_buffer_t& buffer, Args& ... args)
 {
     unpack_from(buffer.data(), args...);
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// The same, but with explicitly specified policy (for example - byte order)
+
+template <typename Policy, typename ... Args,
+
+          // Deduced types
+          typename unpacker_t = values_unpacker< with_policy<Policy, Args...> >,
+          typename byte_t = typename unpacker_t::byte_t>
+inline CT_CONSTEXPR_PACKING void unpack_from_with(const byte_t* bytes, Args& ... args)
+{
+    unpacker_t::template unpack_values<0>(bytes, args...);
+}
+
+template <typename Policy, typename ... Args,
+
+          // Deduced types
+          typename unpacker_t = values_unpacker< with_policy<Policy, Args...> >,
+          typename byte_buffer_t = typename unpacker_t::info_t::byte_buffer_t
+          >
+inline CT_CONSTEXPR_PACKING void unpack_with(const byte_buffer_t& buffer, Args& ... args)
+{
+    unpack_from_with<Policy>(buffer.data(), args...);
+}
+
 // TODO: this is experimental. Possibly can be removed in future
 template <typename ... Args,
 
@@ -289,7 +449,7 @@ template <typename ... Args,
           typename unpacker_t = values_unpacker<Args...>,
           typename byte_t = typename unpacker_t::byte_t
           >
-tuple_t unpack_as_tuple(const byte_t* bytes)
+CT_CONSTEXPR_PACKING tuple_t unpack_as_tuple(const byte_t* bytes)
 {
     tuple_t tuple;
     unpack_from(bytes, tuple);
@@ -303,11 +463,48 @@ template <typename ... Args,
           typename unpacker_t = values_unpacker<Args...>,
           typename byte_buffer_t = typename unpacker_t::byte_buffer_t
           >
-tuple_t unpack_as_tuple(const byte_buffer_t& buffer)
+CT_CONSTEXPR_PACKING tuple_t unpack_as_tuple(const byte_buffer_t& buffer)
 {
     return unpack_as_tuple<Args...>(buffer.data());
 }
 
+// -----------------------------------------------------------------------------
+// Batch unpacking of same-typed records
+
+/**
+    Opposite to `pack_range()` - unpacks `count` records, placed one after
+    another in `src`, into `out` (which must be dereferenceable into record
+    reference, like `std::vector<record_t>::iterator` or raw pointer).
+
+    Stride between records is compile-time constant, so while current record is
+    unpacked - next records are software-prefetched.
+
+    @return Iterator past the last unpacked record
+*/
+template <typename OutputIt,
+
+          // Deduced types
+          typename record_t = typename std::iterator_traits<OutputIt>::value_type,
+          typename unpacker_t = values_unpacker<record_t>,
+          typename byte_t = typename unpacker_t::byte_t
+          >
+inline OutputIt unpack_range(const byte_t* src, std::size_t count, OutputIt out)
+{
+    constexpr std::size_t STRIDE = unpacker_t::info_t::bytes_count;
+    constexpr std::size_t PREFETCH_RECORDS = utils::prefetch::records_ahead<STRIDE>();
+
+    for(std::size_t i = 0; i < count; ++i, ++out, src += STRIDE)
+    {
+        if((i + PREFETCH_RECORDS) < count) {
+            utils::prefetch::prefetch_bytes<STRIDE>(src + (PREFETCH_RECORDS * STRIDE));
+        }
+
+        unpacker_t::template unpack_values<0>(src, *out);
+    }
+
+    return out;
+}
+
 // -----------------------------------------------------------------------------
 
 } // namespace serialization
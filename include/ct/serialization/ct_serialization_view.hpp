@@ -0,0 +1,267 @@
+#ifndef CT__SERIALIZATION__VIEW_HPP
+#define CT__SERIALIZATION__VIEW_HPP
+
+#include "ct/serialization/ct_serialization_pack.hpp"
+#include "ct/serialization/ct_serialization_unpack.hpp"
+
+#include <tuple> // for std::tuple_element<I, T>
+
+namespace ct {
+
+namespace serialization {
+
+namespace impl {
+
+/**
+    Resolves path of indexes (like `<2, 1, 0>`) inside of type `T` into:
+
+    - `type` - type of the field at that path.
+    - `offset_idx` - index of its (first) flattened offset, relative to `T`
+      (the same `OFFSET_IDX`, which is used by `packer_trait` & `unpacker_trait`).
+    - `bytes_shift` - additional shift in bytes, for items of scalar arrays,
+      which are packed as single flattened value.
+
+    Each index selects item of `std::tuple`, `std::pair` or array. Empty path
+    selects `T` itself. Plain aggregates are selected only as a whole.
+
+    @code
+    std::tuple< i32, std::pair<i8, std::array<i16, 2>> > <-- T
+                     ^                       ^
+                     |                       +-- path <1, 1, 1> --> i16, offset_idx = 2, bytes_shift = 2
+                     +-- path <1>            --> pair,  offset_idx = 1, bytes_shift = 0
+    @endcode
+*/
+template <typename T, std::size_t ... Path>
+struct field_path
+{
+    static_assert(sizeof...(Path) == 0, "Path is too deep: field is not a tuple, pair or array");
+};
+
+// End of path - the field itself
+template <typename T>
+struct field_path<T>
+{
+    using type = T;
+    static constexpr std::size_t offset_idx = 0;
+    static constexpr std::size_t bytes_shift = 0;
+};
+
+// std::tuple: the same per-item offsets calculation logic, as in `values_packer`
+template <typename ... Args, std::size_t IDX, std::size_t ... Path>
+struct field_path< std::tuple<Args...>, IDX, Path... >
+{
+    static_assert(IDX < sizeof...(Args), "Tuple item index is out of range");
+
+    using next_t = field_path< typename std::tuple_element< IDX, std::tuple<Args...> >::type, Path... >;
+
+    using type = typename next_t::type;
+    static constexpr std::size_t offset_idx = next_t::offset_idx + utils::get_memcpy_values_offset<IDX, Args...>();
+    static constexpr std::size_t bytes_shift = next_t::bytes_shift;
+};
+
+// std::pair
+template <typename First, typename Second, std::size_t IDX, std::size_t ... Path>
+struct field_path< std::pair<First, Second>, IDX, Path... >
+{
+    static_assert(IDX < 2, "Pair item index is out of range");
+
+    using next_t = field_path< typename std::tuple_element< IDX, std::pair<First, Second> >::type, Path... >;
+
+    using type = typename next_t::type;
+    static constexpr std::size_t offset_idx = next_t::offset_idx + ((IDX == 0) ? 0 : utils::get_memcpy_values_count<First>());
+    static constexpr std::size_t bytes_shift = next_t::bytes_shift;
+};
+
+// Common implementation for arrays
+template <typename T, std::size_t SIZE, std::size_t IDX, bool IS_SCALAR, std::size_t ... Path>
+struct array_item_path
+{
+    static_assert(IDX < SIZE, "Array item index is out of range");
+    static_assert(ct::is_looped_array< T[SIZE] >::value == false, "Items of arrays, which are too big for unrolling, have no own flattened offsets - get the whole array");
+
+    // Array of non-scalar types - each item has its own flattened offsets
+    using next_t = field_path< T, Path... >;
+
+    using type = typename next_t::type;
+    static constexpr std::size_t offset_idx = next_t::offset_idx + (IDX * utils::get_memcpy_values_count<T>());
+    static constexpr std::size_t bytes_shift = next_t::bytes_shift;
+};
+
+template <typename T, std::size_t SIZE, std::size_t IDX, std::size_t ... Path>
+struct array_item_path<T, SIZE, IDX, true, Path...>
+{
+    static_assert(IDX < SIZE, "Array item index is out of range");
+    static_assert(sizeof...(Path) == 0, "Path is too deep: array item is scalar or aggregate");
+
+    // Array of scalar types (or of aggregates without padding) packed as
+    // single value - item is placed right after previous items
+    using type = T;
+    static constexpr std::size_t offset_idx = 0;
+    static constexpr std::size_t bytes_shift = IDX * sizeof(T);
+};
+
+template <typename T, std::size_t SIZE, std::size_t IDX, std::size_t ... Path>
+struct field_path< std::array<T, SIZE>, IDX, Path... >
+        : array_item_path< T, SIZE, IDX, std::is_scalar<T>::value || ct::is_packed_aggregate<T>::value, Path... >
+{};
+
+template <typename T, std::size_t SIZE, std::size_t IDX, std::size_t ... Path>
+struct field_path< T[SIZE], IDX, Path... >
+        : array_item_path< T, SIZE, IDX, std::is_scalar<T>::value || ct::is_packed_aggregate<T>::value, Path... >
+{};
+
+// -----------------------------------------------------------------------------
+
+// Types of record fields, without attached policy
+template <typename ... Types>
+struct view_fields
+{
+    using tuple_t = std::tuple<Types...>;
+};
+
+template <typename Policy, typename ... Types>
+struct view_fields< with_policy<Policy, Types...> >
+{
+    using tuple_t = std::tuple<Types...>;
+};
+
+} // namespace impl
+
+// -----------------------------------------------------------------------------
+
+/**
+    Zero-copy read-only view over packed `<Types...>` record. Each `get<>()`
+    unpacks just single field (by compile-time offset), instead of the whole
+    record.
+
+    Fields are selected by path of indexes: first index - index in `Types...`,
+    each next - index of item inside of previous tuple, pair or array.
+
+    @code{.cpp}
+    using view_t = ct::serialization::view< std::int32_t, std::pair<std::int8_t, std::array<std::int16_t, 2>> >;
+
+    const view_t view(bytes.data());
+
+    const std::int32_t  v0 = view.get<0>();
+    const std::int16_t v11 = view.get<1, 1, 1>();
+    @endcode
+
+    Policy (for example - byte order) may be attached as for `values_unpacker`:
+    `view< with_policy<Policy, Types...> >`.
+
+    @note View does not own bytes, so buffer must outlive it.
+*/
+template <typename ... Types>
+class view
+{
+public:
+    using info_t = typename unpacker_trait<Types...>::info_t;
+    using byte_t = typename info_t::byte_t;
+    using byte_buffer_t = typename info_t::byte_buffer_t;
+
+    template <std::size_t ... Path>
+    using field_path_t = impl::field_path< typename impl::view_fields<Types...>::tuple_t, Path... >;
+
+    template <std::size_t ... Path>
+    using field_t = typename field_path_t<Path...>::type;
+
+    explicit constexpr view(const byte_t* data)
+        : m_data(data)
+    {}
+
+    explicit constexpr view(const byte_buffer_t& buffer)
+        : m_data(buffer.data())
+    {}
+
+    constexpr const byte_t* data() const {
+        return m_data;
+    }
+
+    template <std::size_t ... Path>
+    CT_CONSTEXPR_PACKING field_t<Path...> get() const
+    {
+        using path_t = field_path_t<Path...>;
+
+        field_t<Path...> value {};
+        unpacker_trait<Types...>::template specialized_for< field_t<Path...> >::template unpack<path_t::offset_idx>(m_data + path_t::bytes_shift, value);
+        return value;
+    }
+
+protected:
+    const byte_t* m_data;
+};
+
+/**
+    The same as `view`, but also allows to overwrite single fields by `set<>()`
+    (with the same path of indexes), without touching other bytes.
+
+    @code{.cpp}
+    const ct::serialization::mutable_view< std::int32_t, std::pair<std::int8_t, std::int16_t> > view(bytes.data());
+
+    view.set<1, 0>( std::int8_t{42} );
+    @endcode
+*/
+template <typename ... Types>
+class mutable_view
+        : public view<Types...>
+{
+public:
+    using base_t = view<Types...>;
+
+    using typename base_t::info_t;
+    using typename base_t::byte_t;
+    using typename base_t::byte_buffer_t;
+
+    template <std::size_t ... Path>
+    using field_path_t = typename base_t::template field_path_t<Path...>;
+
+    template <std::size_t ... Path>
+    using field_t = typename base_t::template field_t<Path...>;
+
+    explicit constexpr mutable_view(byte_t* data)
+        : base_t(data)
+    {}
+
+    explicit constexpr mutable_view(byte_buffer_t& buffer)
+        : base_t(buffer.data())
+    {}
+
+    byte_t* data() const {
+        return const_cast<byte_t*>(this->m_data); // Safe: constructed from non-const pointer
+    }
+
+    template <std::size_t ... Path>
+    CT_CONSTEXPR_PACKING void set(const field_t<Path...>& value) const
+    {
+        using path_t = field_path_t<Path...>;
+
+        packer_trait<Types...>::template specialized_for< field_t<Path...> >::template pack<path_t::offset_idx>(data() + path_t::bytes_shift, value);
+    }
+};
+
+// -----------------------------------------------------------------------------
+
+#if defined(CT_ENABLE_TESTS)
+namespace tests {
+
+    using view_input_t = std::tuple< std::int32_t, std::pair<std::int8_t, std::array<std::int16_t, 2>>, std::array<std::pair<std::int8_t, std::int64_t>, 2> >;
+
+    static_assert( std::is_same< impl::field_path<view_input_t, 1>::type, std::pair<std::int8_t, std::array<std::int16_t, 2>> >::value, "Test failed");
+    static_assert( impl::field_path<view_input_t, 1>::offset_idx == 1, "Test failed");
+
+    static_assert( std::is_same< impl::field_path<view_input_t, 1, 1, 1>::type, std::int16_t >::value, "Test failed");
+    static_assert( impl::field_path<view_input_t, 1, 1, 1>::offset_idx  == 2, "Test failed");
+    static_assert( impl::field_path<view_input_t, 1, 1, 1>::bytes_shift == 2, "Test failed");
+
+    static_assert( std::is_same< impl::field_path<view_input_t, 2, 1, 1>::type, std::int64_t >::value, "Test failed");
+    static_assert( impl::field_path<view_input_t, 2, 1, 1>::offset_idx  == 6, "Test failed");
+    static_assert( impl::field_path<view_input_t, 2, 1, 1>::bytes_shift == 0, "Test failed");
+
+} // namespace tests
+#endif // defined(CT_ENABLE_TESTS)
+
+} // namespace serialization
+
+} // namespace ct
+
+#endif // CT__SERIALIZATION__VIEW_HPP
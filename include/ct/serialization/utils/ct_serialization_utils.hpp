@@ -8,6 +8,8 @@
 
 #include "ct/serialization/utils/ct_serialization_utils_memcpy_values_count.hpp"
 
+#include "ct/serialization/utils/ct_serialization_utils_policy.hpp"
+
 #include "ct/ct_test_equal.hpp"
 
 
@@ -32,6 +34,13 @@ struct sizeofs_maker< ct::utils::List<Types...> >
         return sizeofs_array_t { ct::get_bytes_count<Types>() ... };
     }
 
+    // Natural alignments of (flattened) types. For arrays - alignment of item
+    using alignments_array_t = std::array<std::size_t, count>;
+
+    static constexpr alignments_array_t get_alignments()
+    {
+        return alignments_array_t { alignof(Types) ... };
+    }
 };
 
 #if defined(CT_ENABLE_TESTS)
@@ -60,6 +69,10 @@ struct flat_offsets_maker
     {
         return utils::offsets::offsets_utils<count>::calc_offsets( sizeofs_maker_t::get_sizeofs() );
     }
+
+    // No padding, so no alignment requirements
+    static constexpr std::size_t bytes_count = ct::get_bytes_count<Types...>();
+    static constexpr std::size_t alignment = 1;
 };
 
 #if defined(CT_ENABLE_TESTS)
@@ -76,16 +89,153 @@ static_assert( ct::equal( flat_offsets_maker< std::array< std::pair< std::array<
 
 // -----------------------------------------------------------------------------
 
-namespace utils {
+// The same as `flat_offsets_maker`, but for `fields_layout::aligned` - each
+// flattened type placed at offset, multiple of its alignment
+template <typename ... Types>
+struct aligned_flat_offsets_maker
+{
+    // Convenient shortcut-aliases
+    using sizeofs_maker_t = sizeofs_maker< typename ct::flattened<Types...>::type >;
+    using offsets_utils_t = utils::offsets::offsets_utils<sizeofs_maker_t::count>;
+
+    static constexpr std::size_t count = sizeofs_maker_t::count;
+    using offsets_array_t = typename sizeofs_maker_t::sizeofs_array_t; // same as sizeofs array
+
+    static constexpr offsets_array_t get_flat_offsets()
+    {
+        return offsets_utils_t::calc_aligned_offsets( sizeofs_maker_t::get_sizeofs(), sizeofs_maker_t::get_alignments() );
+    }
+
+    // Including trailing padding
+    static constexpr std::size_t bytes_count = offsets_utils_t::aligned_bytes_count( sizeofs_maker_t::get_sizeofs(), sizeofs_maker_t::get_alignments() );
+    static constexpr std::size_t alignment = offsets_utils_t::max_alignment( sizeofs_maker_t::get_alignments() );
+};
+
+#if defined(CT_ENABLE_TESTS)
+namespace tests {
+
+static_assert( ct::equal( aligned_flat_offsets_maker<input_t>::get_flat_offsets(), std::array<std::size_t, 4>{0, 2, 4, 8}), "Test failed");
+static_assert( aligned_flat_offsets_maker<input_t>::bytes_count == 24, "Test failed");
+static_assert( aligned_flat_offsets_maker<input_t>::alignment   ==  4, "Test failed");
+
+static_assert( ct::equal( aligned_flat_offsets_maker< std::array< std::pair<std::int16_t, std::int32_t>, 2> >::get_flat_offsets(), std::array<std::size_t, 4>{0, 4, 8, 12}), "Test failed");
+static_assert( aligned_flat_offsets_maker< std::array< std::pair<std::int16_t, std::int32_t>, 2> >::bytes_count == 16, "Test failed");
 
+static_assert( ct::equal( aligned_flat_offsets_maker< std::int8_t, std::array<std::int16_t, 3>, std::int64_t >::get_flat_offsets(), std::array<std::size_t, 3>{0, 2, 8}), "Test failed");
+static_assert( aligned_flat_offsets_maker< std::int8_t, std::array<std::int16_t, 3>, std::int64_t >::bytes_count == 16, "Test failed");
+
+} // namespace tests
+#endif // defined(CT_ENABLE_TESTS)
+
+// -----------------------------------------------------------------------------
+
+// The same as `aligned_flat_offsets_maker`, but for `fields_layout::reordered` -
+// flattened types placed in order of decreasing alignment, so padding may
+// appear only at the end (and after densely packed big arrays)
 template <typename ... Types>
-struct types_sizeofs_info
+struct reordered_flat_offsets_maker
+{
+    // Convenient shortcut-aliases
+    using sizeofs_maker_t = sizeofs_maker< typename ct::flattened<Types...>::type >;
+    using offsets_utils_t = utils::offsets::offsets_utils<sizeofs_maker_t::count>;
+
+    static constexpr std::size_t count = sizeofs_maker_t::count;
+    using offsets_array_t = typename sizeofs_maker_t::sizeofs_array_t; // same as sizeofs array
+
+    // Offsets are still indexed by flattened types (in declaration order), so
+    // packer & unpacker use them as-is
+    static constexpr offsets_array_t get_flat_offsets()
+    {
+        return offsets_utils_t::calc_reordered_offsets( sizeofs_maker_t::get_sizeofs(), sizeofs_maker_t::get_alignments() );
+    }
+
+    // Including trailing padding
+    static constexpr std::size_t bytes_count = offsets_utils_t::reordered_bytes_count( sizeofs_maker_t::get_sizeofs(), sizeofs_maker_t::get_alignments() );
+    static constexpr std::size_t alignment = offsets_utils_t::max_alignment( sizeofs_maker_t::get_alignments() );
+};
+
+#if defined(CT_ENABLE_TESTS)
+namespace tests {
+
+static_assert( ct::equal( reordered_flat_offsets_maker<std::int8_t, std::int64_t, std::int16_t, std::int32_t>::get_flat_offsets(), std::array<std::size_t, 4>{14, 0, 12, 8}), "Test failed");
+static_assert( reordered_flat_offsets_maker<std::int8_t, std::int64_t, std::int16_t, std::int32_t>::bytes_count == 16, "Test failed");
+static_assert( aligned_flat_offsets_maker  <std::int8_t, std::int64_t, std::int16_t, std::int32_t>::bytes_count == 24, "Test failed");
+
+static_assert( ct::equal( reordered_flat_offsets_maker<input_t>::get_flat_offsets(), std::array<std::size_t, 4>{16, 18, 20, 0}), "Test failed");
+static_assert( reordered_flat_offsets_maker<input_t>::bytes_count == 24, "Test failed");
+
+static_assert( ct::equal( reordered_flat_offsets_maker< std::int8_t, std::array<std::int16_t, 3>, std::int64_t >::get_flat_offsets(), std::array<std::size_t, 3>{14, 8, 0}), "Test failed");
+static_assert( reordered_flat_offsets_maker< std::int8_t, std::array<std::int16_t, 3>, std::int64_t >::bytes_count == 16, "Test failed");
+
+} // namespace tests
+#endif // defined(CT_ENABLE_TESTS)
+
+// -----------------------------------------------------------------------------
+
+// Selection of offsets maker by fields layout
+template <fields_layout LAYOUT, typename ... Types>
+struct layout_offsets_maker {};
+
+template <typename ... Types>
+struct layout_offsets_maker<fields_layout::packed, Types...>
+{
+    using type = flat_offsets_maker<Types...>;
+};
+
+template <typename ... Types>
+struct layout_offsets_maker<fields_layout::aligned, Types...>
+{
+    using type = aligned_flat_offsets_maker<Types...>;
+};
+
+template <typename ... Types>
+struct layout_offsets_maker<fields_layout::reordered, Types...>
 {
-    using flat_offsets_maker_t = flat_offsets_maker<Types...>;
+    using type = reordered_flat_offsets_maker<Types...>;
+};
+
+// -----------------------------------------------------------------------------
+
+namespace utils {
+
+/**
+    `std::array<T, SIZE>`, aligned by `ALIGNMENT` bytes.
+
+    Used as bytes buffer for layouts with aligned fields, to make fields of
+    packed data aligned in memory too.
+*/
+template <typename T, std::size_t SIZE, std::size_t ALIGNMENT>
+struct alignas(ALIGNMENT) aligned_array
+        : std::array<T, SIZE>
+{};
+
+template <typename T, std::size_t SIZE, std::size_t ALIGNMENT>
+struct aligned_array_maker
+{
+    using type = aligned_array<T, SIZE, ALIGNMENT>;
+};
+
+// Without alignment requirements - simply std::array
+template <typename T, std::size_t SIZE>
+struct aligned_array_maker<T, SIZE, 1>
+{
+    using type = std::array<T, SIZE>;
+};
+
+// -----------------------------------------------------------------------------
+
+// Information about packed types, with specified policy
+template <typename Policy, typename ... Types>
+struct policy_types_sizeofs_info
+{
+    using policy_t = Policy;
+
+    using flat_offsets_maker_t = typename layout_offsets_maker<policy_t::layout, Types...>::type;
 
     using byte_t = std::int8_t;
-    static constexpr std::size_t bytes_count = ct::get_bytes_count<Types...>();
-    using byte_buffer_t = std::array<byte_t, bytes_count>;
+    static constexpr std::size_t bytes_count = flat_offsets_maker_t::bytes_count;
+    static constexpr std::size_t alignment = flat_offsets_maker_t::alignment;
+    using byte_buffer_t = typename aligned_array_maker<byte_t, bytes_count, alignment>::type;
 
 
     // Primary function, for getting flattened offsets for <Types...>
@@ -104,6 +254,18 @@ struct types_sizeofs_info
 
 };
 
+// Information about packed types (with default policy)
+template <typename ... Types>
+struct types_sizeofs_info
+        : policy_types_sizeofs_info<default_policy, Types...>
+{};
+
+// Specialization for types with attached policy
+template <typename Policy, typename ... Types>
+struct types_sizeofs_info< with_policy<Policy, Types...> >
+        : policy_types_sizeofs_info<Policy, Types...>
+{};
+
 } // namespace utils
 
 } // namespace serialization
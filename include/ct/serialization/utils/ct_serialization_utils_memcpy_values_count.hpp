@@ -2,6 +2,8 @@
 #define CT__SERIALIZATION__UTILS__MEMCPY_VALUES_COUNT_HPP
 
 #include "ct/utils/ct_utils_accumulate.hpp"
+#include "ct/serialization/utils/ct_serialization_utils_offsets.hpp"
+#include "ct/ct_array_unroll.hpp"
 
 /*
     Important note: next trait below basically the same as
@@ -13,7 +15,13 @@
     may be SAFELY copied via `std::memcpy()` as single peace, or as single value.
 
     In other cases (arrays of non-scalar or nested/custom types) its returns
-    items count, because we need to copy such array item-by-item.
+    items count, because we need to copy such array item-by-item. Except too
+    big arrays (see `CT_ARRAY_UNROLL_THRESHOLD`) - they are packed by runtime
+    loop, as single value.
+
+    Plain aggregates without padding (see `ct::is_packed_aggregate<T>`) - also
+    single value, as well as arrays of them. Other plain aggregates - the same
+    as std::tuple of their fields.
  */
 
 namespace ct {
@@ -24,10 +32,10 @@ namespace utils {
 
 namespace impl {
 
-template <typename T>
+template <typename T, typename Enabled = void>
 struct memcpy_values_count_trait
 {
-    static_assert(std::is_pod<T>::value == true, "T must be a POD type");
+    static_assert(std::is_trivial<T>::value && std::is_standard_layout<T>::value, "T must be a POD type"); // std::is_pod<T> is deprecated since C++20
 
     static constexpr std::size_t values_count = 1;
 };
@@ -37,7 +45,7 @@ template <typename T, std::size_t SIZE>
 struct memcpy_values_count_trait< T[SIZE] >
 {
     static constexpr std::size_t values_count
-        = (std::is_scalar<T>::value == true) ?
+        = ((std::is_scalar<T>::value == true) || ct::is_looped_array< T[SIZE] >::value) ?
             1
             :
             (SIZE * memcpy_values_count_trait<T>::values_count);
@@ -48,7 +56,7 @@ template <typename T, std::size_t SIZE>
 struct memcpy_values_count_trait< std::array<T, SIZE> >
 {
     static constexpr std::size_t values_count
-        = (std::is_scalar<T>::value == true) ?
+        = ((std::is_scalar<T>::value == true) || ct::is_looped_array< std::array<T, SIZE> >::value) ?
             1
             :
             (SIZE * memcpy_values_count_trait<T>::values_count);
@@ -70,6 +78,19 @@ struct memcpy_values_count_trait< std::tuple<Types...> >
         = ct::utils::accumulate( { memcpy_values_count_trait<Types>::values_count ...}, std::size_t{0});
 };
 
+#if CT_HAS_AGGREGATE_DECOMPOSITION
+// Specialization for plain aggregates
+template <typename T>
+struct memcpy_values_count_trait< T, typename std::enable_if< ct::is_decomposable_aggregate<T>::value >::type >
+{
+    static constexpr std::size_t values_count
+        = ct::is_packed_aggregate<T>::value ?
+            1
+            :
+            memcpy_values_count_trait< typename ct::aggregate_trait<T>::fields_t >::values_count;
+};
+#endif
+
 } // namespace impl
 
 // -----------------------------------------------------------------------------
@@ -81,6 +102,44 @@ constexpr std::size_t get_memcpy_values_count() {
 
 // -----------------------------------------------------------------------------
 
+/**
+    Index of the first flattened offset of each of `<Types...>` - exclusive
+    prefix sum of their memcpy values counts:
+
+    @code
+    < i32, <i64, i16>, <i8, <i32, i16>> > <-- Types
+    [   1,          2,                3 ] <-- memcpy values counts
+    -------------------------------------
+    [   0,          1,                3 ] <-- offsets
+    @endcode
+
+    Calculated once for all `<Types...>` (instead of calculating memcpy values
+    count of first `N` types for each `N`).
+*/
+template <typename ... Types>
+struct memcpy_values_offsets
+{
+    static constexpr std::size_t count = sizeof...(Types);
+
+    using counts_array_t = std::array<std::size_t, count>;
+    using offsets_array_t = std::array<std::size_t, count>;
+
+    static constexpr offsets_array_t offsets = utils::offsets::offsets_utils<count>::calc_offsets(
+        counts_array_t{ impl::memcpy_values_count_trait<Types>::values_count ... }
+    );
+};
+
+template <typename ... Types>
+constexpr typename memcpy_values_offsets<Types...>::offsets_array_t memcpy_values_offsets<Types...>::offsets;
+
+// Index of the first flattened offset of type at `IDX` in `<Types...>`
+template <std::size_t IDX, typename ... Types>
+constexpr std::size_t get_memcpy_values_offset() {
+    return std::get<IDX>( memcpy_values_offsets<Types...>::offsets );
+}
+
+// -----------------------------------------------------------------------------
+
 #if defined(CT_ENABLE_TESTS)
 namespace tests {
 
@@ -101,6 +160,9 @@ namespace tests {
     // Nested std::arrays sizes checking
     static_assert( get_memcpy_values_count< std::array< std::array<std::int32_t, 4>, 7> >() == (1*7), "Test failed");
 
+    // Too big arrays of non-scalar types are not unrolled
+    static_assert( get_memcpy_values_count< std::array< std::pair<std::int8_t, std::int32_t>, (CT_ARRAY_UNROLL_THRESHOLD + 1)> >() == 1, "Test failed");
+
     // Extreme nested std::array case
     static_assert( get_memcpy_values_count< std::array<std::array<std::array<std::array<std::int32_t,5>,6>,7>,8> >() == (1*6*7*8), "Test failed");
 
@@ -124,6 +186,14 @@ namespace tests {
     // Parameters pack test
     static_assert( get_memcpy_values_count<std::int8_t, std::int16_t, std::int32_t>() == 3, "Test failed");
 
+    // -------------------------------------------------------------------------
+
+    // Offsets of parameters pack items
+    static_assert( get_memcpy_values_offset<0, std::int32_t, std::pair<std::int64_t, std::int16_t>, std::tuple<std::int8_t, std::pair<std::int32_t, std::int16_t>> >() == 0, "Test failed");
+    static_assert( get_memcpy_values_offset<1, std::int32_t, std::pair<std::int64_t, std::int16_t>, std::tuple<std::int8_t, std::pair<std::int32_t, std::int16_t>> >() == 1, "Test failed");
+    static_assert( get_memcpy_values_offset<2, std::int32_t, std::pair<std::int64_t, std::int16_t>, std::tuple<std::int8_t, std::pair<std::int32_t, std::int16_t>> >() == 3, "Test failed");
+    static_assert( get_memcpy_values_offset<2, std::array<std::int8_t, 4>, std::array<std::pair<std::int8_t, std::int8_t>, 3>, std::int8_t >() == (1+6), "Test failed");
+
 } // namespace tests
 #endif // defined(CT_ENABLE_TESTS)
 
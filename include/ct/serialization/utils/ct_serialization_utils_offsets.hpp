@@ -2,6 +2,7 @@
 #define CT__SERIALIZATION__UTILS__OFFSETS_HPP
 
 #include "ct/utils/ct_utils_index_sequence.hpp"
+#include "ct/utils/ct_utils_constexpr.hpp"
 #include "ct/ct_bytes_utils.hpp"
 
 #if defined(CT_ENABLE_TESTS)
@@ -49,19 +50,320 @@ struct offsets_utils
     static constexpr std::size_t accumulate_sizeofs(const offsets_array_t& sizeofs_array, std::size_t curr_idx)
     {
         // First element (at index 0) always have offset 0
-        // Offsets calculation is done recursively, backwards (from `curr_idx` until 0)
-        return (curr_idx == 0) ? 0 : ( sizeofs_array[curr_idx-1] + accumulate_sizeofs(sizeofs_array, curr_idx-1) );
+        return sum_sizeofs(sizeofs_array, 0, curr_idx);
     }
 
+    // Sum of sizeofs in range [first, last) - by splitting into halves, so
+    // constexpr evaluation depth is log2(count), not count
+    static constexpr std::size_t sum_sizeofs(const sizeofs_array_t& sizeofs_array, std::size_t first, std::size_t last)
+    {
+        return (first == last) ? 0 :
+            ((last - first) == 1) ? sizeofs_array[first] :
+            ( sum_sizeofs(sizeofs_array, first, first + ((last - first) / 2)) + sum_sizeofs(sizeofs_array, first + ((last - first) / 2), last) );
+    }
+
+    /**
+        All offsets are calculated at once, as prefix sums (instead of
+        `accumulate_sizeofs()` for each index - which is O(count^2)). Each step
+        adds to each item the item, placed `shift` items before it, and `shift`
+        is doubled - so only log2(count) steps are required:
+
+        @code
+        [ 1,   4,   4,   2] <-- sizeofs
+        [ 1,   5,   8,   6] <-- step: shift = 1
+        [ 1,   5,   9,  11] <-- step: shift = 2 - inclusive sums
+        --------------------
+        [ 0,   1,   5,   9] <-- result offsets (shifted by single item)
+        @endcode
+    */
+    template <int ... Indexes>
+    static constexpr sizeofs_array_t scan_step(const sizeofs_array_t& sums_array, std::size_t shift, ct::ind_seq::index<Indexes...> )
+    {
+        return sizeofs_array_t{ ( (static_cast<std::size_t>(Indexes) >= shift) ? (sums_array[Indexes] + sums_array[static_cast<std::size_t>(Indexes) - shift]) : sums_array[Indexes] ) ...};
+    }
+
+    static constexpr sizeofs_array_t inclusive_scan(const sizeofs_array_t& sums_array, std::size_t shift = 1)
+    {
+        return (shift >= count) ? sums_array : inclusive_scan( scan_step(sums_array, shift, ct::ind_seq::gen_seq<count>{}), shift * 2 );
+    }
+
+    template <int ... Indexes>
+    static constexpr offsets_array_t calc_offsets_impl(const sizeofs_array_t& sums_array, ct::ind_seq::index<Indexes...> )
+    {
+        return offsets_array_t{ ( (Indexes == 0) ? 0 : sums_array[static_cast<std::size_t>(Indexes) - 1] ) ...};
+    }
+
+#if CT_HAS_RELAXED_CONSTEXPR
+    // Mutable storage for single-pass calculations: std::array is not mutable
+    // in constant expressions before C++17 (+1 - to not make zero-sized array)
+    struct values_holder {
+        std::size_t values[count + 1];
+    };
+
     template <int ... Indexes>
-    static constexpr offsets_array_t calc_offsets_impl(const sizeofs_array_t& sizeofs_array, ct::ind_seq::index<Indexes...> )
+    static constexpr std::array<std::size_t, count> to_array(const values_holder& holder, ct::ind_seq::index<Indexes...> )
     {
-        return offsets_array_t{ accumulate_sizeofs(sizeofs_array, Indexes) ...};
+        return std::array<std::size_t, count>{ holder.values[Indexes] ...};
     }
+#endif
 
+    // With relaxed constexpr - single pass, otherwise (C++11) - log2(count)
+    // steps of `scan_step()`
     static constexpr offsets_array_t calc_offsets(const sizeofs_array_t& sizeofs)
     {
-        return calc_offsets_impl(sizeofs, ct::ind_seq::gen_seq<count>{});
+#if CT_HAS_RELAXED_CONSTEXPR
+        values_holder offsets {};
+
+        std::size_t offset = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            offsets.values[i] = offset;
+            offset += sizeofs[i];
+        }
+
+        return to_array(offsets, ct::ind_seq::gen_seq<count>{});
+#else
+        return calc_offsets_impl(inclusive_scan(sizeofs), ct::ind_seq::gen_seq<count>{});
+#endif
+    }
+
+    // -------------------------------------------------------------------------
+    // Offsets with natural alignment of each item
+
+    using alignments_array_t = std::array<std::size_t, count>;
+
+    static constexpr std::size_t align_up(std::size_t value, std::size_t alignment)
+    {
+        return ((value + alignment - 1) / alignment) * alignment;
+    }
+
+    /**
+        Placement of items, as function of offset before them:
+        `offset -> align_up(offset + shift, alignment) + size`. Single item is
+        `{0, alignof(item), sizeof(item)}`, and, since alignments are powers of
+        2, placement of several items one after another is the same function
+        (see `compose()`) - so end offsets of all items are prefix
+        "sums" of placements, calculated in log2(count) steps, like
+        `calc_offsets()`:
+
+        @code
+        <i8, i32, i16, i64> <-- types
+        [ 1,   4,   2,   8] <-- sizeofs
+        [ 1,   4,   2,   8] <-- alignments
+        -------------------
+        [ 1,   8,  10,  24] <-- end offsets (prefix placements, applied to 0)
+        [ 0,   4,   8,  16] <-- result offsets (end offsets - sizeofs)
+        @endcode
+    */
+    struct placement
+    {
+        std::size_t shift;
+        std::size_t alignment;
+        std::size_t size;
+    };
+
+    using placements_array_t = std::array<placement, count>;
+
+    // Placement of `first`, then `second`. With `a1` & `a2` - their alignments:
+    // - `a2 <= a1`: end of `first` (without its tail `size`) is multiple of
+    //   `a2`, so `second` only adds aligned tail;
+    // - `a2 > a1`: `a1` divides `a2`, so rounding up to `a1` may be moved into
+    //   tail of `first` - and then it is absorbed by rounding up to `a2`.
+    static constexpr placement compose(const placement& first, const placement& second)
+    {
+        return (second.alignment <= first.alignment)
+            ? placement{ first.shift, first.alignment, align_up(first.size + second.shift, second.alignment) + second.size }
+            : placement{ first.shift + align_up(first.size + second.shift, first.alignment), second.alignment, second.size };
+    }
+
+    static constexpr std::size_t end_offset(const placement& items)
+    {
+        return align_up(items.shift, items.alignment) + items.size;
+    }
+
+    template <int ... Indexes>
+    static constexpr placements_array_t make_placements(const sizeofs_array_t& sizeofs_array, const alignments_array_t& alignments_array, ct::ind_seq::index<Indexes...> )
+    {
+        return placements_array_t{ placement{ 0, alignments_array[Indexes], sizeofs_array[Indexes] } ...};
+    }
+
+    template <int ... Indexes>
+    static constexpr placements_array_t placements_scan_step(const placements_array_t& placements_array, std::size_t shift, ct::ind_seq::index<Indexes...> )
+    {
+        return placements_array_t{ ( (static_cast<std::size_t>(Indexes) >= shift) ? compose(placements_array[static_cast<std::size_t>(Indexes) - shift], placements_array[Indexes]) : placements_array[Indexes] ) ...};
+    }
+
+    static constexpr placements_array_t inclusive_placements_scan(const placements_array_t& placements_array, std::size_t shift = 1)
+    {
+        return (shift >= count) ? placements_array : inclusive_placements_scan( placements_scan_step(placements_array, shift, ct::ind_seq::gen_seq<count>{}), shift * 2 );
+    }
+
+    static constexpr placements_array_t calc_placements(const sizeofs_array_t& sizeofs, const alignments_array_t& alignments)
+    {
+        return inclusive_placements_scan( make_placements(sizeofs, alignments, ct::ind_seq::gen_seq<count>{}) );
+    }
+
+    template <int ... Indexes>
+    static constexpr offsets_array_t calc_aligned_offsets_impl(const placements_array_t& placements_array, const sizeofs_array_t& sizeofs_array, ct::ind_seq::index<Indexes...> )
+    {
+        return offsets_array_t{ (end_offset(placements_array[Indexes]) - sizeofs_array[Indexes]) ...};
+    }
+
+    // With relaxed constexpr - single pass, otherwise (C++11) - log2(count)
+    // steps of `placements_scan_step()`
+    static constexpr offsets_array_t calc_aligned_offsets(const sizeofs_array_t& sizeofs, const alignments_array_t& alignments)
+    {
+#if CT_HAS_RELAXED_CONSTEXPR
+        values_holder offsets {};
+
+        std::size_t offset = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            offsets.values[i] = align_up(offset, alignments[i]);
+            offset = offsets.values[i] + sizeofs[i];
+        }
+
+        return to_array(offsets, ct::ind_seq::gen_seq<count>{});
+#else
+        return calc_aligned_offsets_impl(calc_placements(sizeofs, alignments), sizeofs, ct::ind_seq::gen_seq<count>{});
+#endif
+    }
+
+    static constexpr std::size_t max_of(std::size_t lhs, std::size_t rhs)
+    {
+        return (lhs > rhs) ? lhs : rhs;
+    }
+
+    // Largest alignment in range [first, last) (or 1 for empty range) - by
+    // splitting into halves
+    static constexpr std::size_t max_alignment_range(const alignments_array_t& alignments_array, std::size_t first, std::size_t last)
+    {
+        return (first == last) ? 1 :
+            ((last - first) == 1) ? alignments_array[first] :
+            max_of( max_alignment_range(alignments_array, first, first + ((last - first) / 2)), max_alignment_range(alignments_array, first + ((last - first) / 2), last) );
+    }
+
+    // Largest alignment (or 1 for empty array)
+    static constexpr std::size_t max_alignment(const alignments_array_t& alignments_array)
+    {
+        return max_alignment_range(alignments_array, 0, count);
+    }
+
+    // End offset of last item (const reference - non-const `operator[]` of
+    // temporary is not constexpr in C++11)
+    static constexpr std::size_t last_end_offset(const placements_array_t& placements_array)
+    {
+        return end_offset(placements_array[count - 1]);
+    }
+
+    // Bytes count of all items, placed at aligned offsets (including padding at
+    // the end - to make next same items properly aligned)
+    static constexpr std::size_t aligned_bytes_count(const sizeofs_array_t& sizeofs, const alignments_array_t& alignments)
+    {
+#if CT_HAS_RELAXED_CONSTEXPR
+        std::size_t offset = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            offset = align_up(offset, alignments[i]) + sizeofs[i];
+        }
+
+        return align_up(offset, max_alignment(alignments));
+#else
+        return (count == 0) ? 0 : align_up( last_end_offset(calc_placements(sizeofs, alignments)), max_alignment(alignments) );
+#endif
+    }
+
+    // -------------------------------------------------------------------------
+    // Offsets of items, reordered by decreasing alignment
+
+    // Sizeofs, rounded up to alignments of items: almost always the same, except
+    // big arrays of non-scalar items (see CT_ARRAY_UNROLL_THRESHOLD) - they are
+    // packed densely, so their size may be not multiple of item alignment
+    template <int ... Indexes>
+    static constexpr sizeofs_array_t calc_padded_sizeofs_impl(const sizeofs_array_t& sizeofs_array, const alignments_array_t& alignments_array, ct::ind_seq::index<Indexes...> )
+    {
+        return sizeofs_array_t{ align_up(sizeofs_array[Indexes], alignments_array[Indexes]) ...};
+    }
+
+    static constexpr sizeofs_array_t calc_padded_sizeofs(const sizeofs_array_t& sizeofs, const alignments_array_t& alignments)
+    {
+        return calc_padded_sizeofs_impl(sizeofs, alignments, ct::ind_seq::gen_seq<count>{});
+    }
+
+    // Sizeofs of items with `alignment` (others - zero)
+    template <int ... Indexes>
+    static constexpr sizeofs_array_t group_sizeofs(const sizeofs_array_t& sizeofs_array, const alignments_array_t& alignments_array, std::size_t alignment, ct::ind_seq::index<Indexes...> )
+    {
+        return sizeofs_array_t{ ( (alignments_array[Indexes] == alignment) ? sizeofs_array[Indexes] : 0 ) ...};
+    }
+
+    template <int ... Indexes>
+    static constexpr offsets_array_t merge_group_offsets(const alignments_array_t& alignments_array, std::size_t alignment, std::size_t base, const offsets_array_t& group_offsets, const offsets_array_t& other_offsets, ct::ind_seq::index<Indexes...> )
+    {
+        return offsets_array_t{ ( (alignments_array[Indexes] == alignment) ? (base + group_offsets[Indexes]) : other_offsets[Indexes] ) ...};
+    }
+
+    static constexpr offsets_array_t place_group(const sizeofs_array_t& sizeofs, const alignments_array_t& alignments, std::size_t alignment, std::size_t base, const sizeofs_array_t& group)
+    {
+        return merge_group_offsets( alignments, alignment, base, calc_offsets(group),
+                                    place_groups(sizeofs, alignments, alignment / 2, base + sum_sizeofs(group, 0, count)),
+                                    ct::ind_seq::gen_seq<count>{} );
+    }
+
+    // Offsets of items with alignment not greater than `alignment` (power of
+    // 2), placed from `base`: each group of items with the same alignment is
+    // placed by `calc_offsets()`, so depth is log2(count) per group
+    static constexpr offsets_array_t place_groups(const sizeofs_array_t& sizeofs, const alignments_array_t& alignments, std::size_t alignment, std::size_t base)
+    {
+        return (alignment == 0) ? offsets_array_t{} :
+            place_group(sizeofs, alignments, alignment, base, group_sizeofs(sizeofs, alignments, alignment, ct::ind_seq::gen_seq<count>{}));
+    }
+
+    /**
+        Offsets of items (in declaration order), placed in order of decreasing
+        alignment - groups of items with the same alignment, one after another.
+        Size of each item is rounded up to its alignment (see
+        `calc_padded_sizeofs()`), so items are naturally aligned, and padding
+        may appear only after densely packed big arrays:
+
+        @code
+        <i8, i64, i16, i32> <-- types
+        [ 1,   8,   2,   4] <-- sizeofs & alignments
+        -------------------
+        [14,   0,  12,   8] <-- result offsets: i64, i32, i16, i8
+        @endcode
+    */
+    static constexpr offsets_array_t calc_reordered_offsets(const sizeofs_array_t& sizeofs, const alignments_array_t& alignments)
+    {
+#if CT_HAS_RELAXED_CONSTEXPR
+        // Single pass per group of items with the same alignment, starting
+        // from the largest one
+        values_holder offsets {};
+
+        std::size_t offset = 0;
+        std::size_t group_alignment = max_alignment(alignments);
+        while (group_alignment > 0)
+        {
+            std::size_t next_alignment = 0;
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                if (alignments[i] == group_alignment) {
+                    offsets.values[i] = offset;
+                    offset += align_up(sizeofs[i], alignments[i]);
+                } else if ((alignments[i] < group_alignment) && (alignments[i] > next_alignment)) {
+                    next_alignment = alignments[i];
+                }
+            }
+            group_alignment = next_alignment;
+        }
+
+        return to_array(offsets, ct::ind_seq::gen_seq<count>{});
+#else
+        return place_groups(calc_padded_sizeofs(sizeofs, alignments), alignments, max_alignment(alignments), 0);
+#endif
+    }
+
+    // Bytes count of reordered items (including trailing padding)
+    static constexpr std::size_t reordered_bytes_count(const sizeofs_array_t& sizeofs, const alignments_array_t& alignments)
+    {
+        return align_up( accumulate_sizeofs(calc_padded_sizeofs(sizeofs, alignments), count), max_alignment(alignments) );
     }
 };
 
@@ -93,6 +395,32 @@ namespace tests {
     static_assert( ct::equal( get_offsets<std::array<std::int8_t,  5>, std::int16_t, std::int32_t>(), std::array<std::size_t, 3>{0, (1*5), (1*5)+2}), "Test failed");
     static_assert( ct::equal( get_offsets<std::array<std::int32_t, 3>, std::int16_t, std::int8_t >(), std::array<std::size_t, 3>{0, (4*3), (4*3)+2}), "Test failed");
 
+    // Test for prefix sums (count is not power of 2)
+    static_assert( ct::equal( offsets_utils<0>::calc_offsets( {} ), std::array<std::size_t, 0>{}), "Test failed");
+    static_assert( ct::equal( offsets_utils<1>::calc_offsets( {7} ), std::array<std::size_t, 1>{0}), "Test failed");
+    static_assert( ct::equal( offsets_utils<7>::calc_offsets( {8, 4, 2, 1, 2, 4, 8} ), std::array<std::size_t, 7>{0, 8, 12, 14, 15, 17, 21}), "Test failed");
+    static_assert( offsets_utils<7>::accumulate_sizeofs( {8, 4, 2, 1, 2, 4, 8}, 7 ) == 29, "Test failed");
+    static_assert( offsets_utils<5>::max_alignment( {2, 8, 1, 4, 8} ) == 8, "Test failed");
+    static_assert( offsets_utils<0>::max_alignment( {} ) == 1, "Test failed");
+
+    // Test for aligned offsets
+    static_assert( ct::equal( offsets_utils<4>::calc_aligned_offsets( {1, 4, 2, 8}, {1, 4, 2, 8} ), std::array<std::size_t, 4>{0, 4, 8, 16}), "Test failed");
+    static_assert( offsets_utils<4>::aligned_bytes_count( {1, 4, 2, 8}, {1, 4, 2, 8} ) == 24, "Test failed");
+    static_assert( offsets_utils<3>::aligned_bytes_count( {1, 4, 2}, {1, 4, 2} ) == 12, "Test failed");
+
+    static_assert( ct::equal( offsets_utils<7>::calc_aligned_offsets( {1, 8, 2, 1, 4, 2, 1}, {1, 8, 2, 1, 4, 2, 1} ), std::array<std::size_t, 7>{0, 8, 16, 18, 20, 24, 26}), "Test failed");
+    static_assert( offsets_utils<7>::aligned_bytes_count( {1, 8, 2, 1, 4, 2, 1}, {1, 8, 2, 1, 4, 2, 1} ) == 32, "Test failed");
+    static_assert( offsets_utils<0>::aligned_bytes_count( {}, {} ) == 0, "Test failed");
+
+    // Test for reordered offsets
+    static_assert( ct::equal( offsets_utils<4>::calc_reordered_offsets( {4, 2, 4, 2}, {4, 2, 4, 2} ), std::array<std::size_t, 4>{0, 8, 4, 10}), "Test failed");
+    static_assert( ct::equal( offsets_utils<4>::calc_reordered_offsets( {1, 8, 2, 4}, {1, 8, 2, 4} ), std::array<std::size_t, 4>{14, 0, 12, 8}), "Test failed");
+    static_assert( offsets_utils<4>::reordered_bytes_count( {1, 8, 2, 4}, {1, 8, 2, 4} ) == 16, "Test failed");
+
+    // Test for reordered offsets after item, which size is not multiple of its alignment
+    static_assert( ct::equal( offsets_utils<3>::calc_reordered_offsets( {1, 1505, 4}, {1, 4, 4} ), std::array<std::size_t, 3>{1512, 0, 1508}), "Test failed");
+    static_assert( offsets_utils<3>::reordered_bytes_count( {1, 1505, 4}, {1, 4, 4} ) == 1516, "Test failed");
+
 } // namespace tests
 #endif // defined(CT_ENABLE_TESTS)
 
@@ -0,0 +1,82 @@
+#ifndef CT__SERIALIZATION__UTILS__POLICY_HPP
+#define CT__SERIALIZATION__UTILS__POLICY_HPP
+
+#include "ct/utils/ct_utils_byte_order.hpp"
+
+namespace ct {
+
+namespace serialization {
+
+/**
+    Placement of flattened (leaf) fields inside of packed record:
+
+    - `packed`  - fields placed one after another without gaps (default).
+    - `aligned` - each field placed at offset, which is multiple of its natural
+      alignment (`alignof()`), and record bytes count is multiple of the largest
+      field alignment - so fields may be accessed by direct aligned loads (if
+      buffer itself is aligned, like `byte_buffer_t`), even when records placed
+      one after another.
+    - `reordered` - fields placed in order of decreasing alignment (fields with
+      the same alignment keep declaration order). Each field is aligned too,
+      but padding may appear only at the end of record (and after big arrays
+      of non-scalar items, which are packed densely - see
+      `CT_ARRAY_UNROLL_THRESHOLD`). Offsets are still
+      indexed in declaration order, so values passed & received as usual.
+
+    @code
+    <i8, i32, i16> <-- types
+
+    packed:    [i8][i32 ][i16]          <-- 7 bytes, offsets: [0, 1, 5]
+    aligned:   [i8]...[i32 ][i16]..     <-- 12 bytes, offsets: [0, 4, 8]
+    reordered: [i32 ][i16][i8].         <-- 8 bytes, offsets: [6, 0, 4]
+    @endcode
+*/
+enum class fields_layout
+{
+    packed,
+    aligned,
+    reordered
+};
+
+/**
+    Compile-time configuration of packed data representation.
+
+    - `ORDER` - byte order of packed scalar values. With `byte_order::native`
+      (default) values copied as-is.
+    - `LAYOUT` - placement of fields (see `fields_layout`).
+
+    Policy is attached to packed types by wrapping them into
+    `with_policy<Policy, Types...>`, which is used in place of `Types...` for
+    `packer_trait<>`, `unpacker_trait<>`, `values_packer<>` and
+    `values_unpacker<>`:
+
+    @code{.cpp}
+    using big_endian_t = ct::serialization::policy< ct::utils::byte_order::big >;
+
+    using packer_t = ct::serialization::values_packer<
+        ct::serialization::with_policy<big_endian_t, std::int32_t, float>
+    >;
+    @endcode
+
+    Or simply by using `pack_with<Policy>()` & `unpack_with<Policy>()`
+    functions family.
+*/
+template <ct::utils::byte_order ORDER = ct::utils::byte_order::native,
+          fields_layout LAYOUT = fields_layout::packed>
+struct policy
+{
+    static constexpr ct::utils::byte_order order = ORDER;
+    static constexpr fields_layout layout = LAYOUT;
+};
+
+using default_policy = policy<>;
+
+// Wrapper for attaching policy to packed types
+template <typename Policy, typename ... Types>
+struct with_policy {};
+
+} // namespace serialization
+
+} // namespace ct
+
+#endif // CT__SERIALIZATION__UTILS__POLICY_HPP
@@ -0,0 +1,81 @@
+#ifndef CT__SERIALIZATION__UTILS__PREFETCH_HPP
+#define CT__SERIALIZATION__UTILS__PREFETCH_HPP
+
+#include <cstddef> // for std::size_t
+
+/*
+    Software prefetching helpers, used by batch (range) unpacking.
+
+    When records are unpacked one-by-one from a large buffer, their location in
+    memory is known long before they are touched, so we can ask the CPU to start
+    loading the next records into the cache while the current one is processed.
+
+    Everything, except the prefetch instruction itself, is computed in
+    compile-time (from the record stride). On compilers without
+    `__builtin_prefetch()` all helpers silently do nothing.
+*/
+
+namespace ct {
+
+namespace serialization {
+
+namespace utils {
+
+namespace prefetch {
+
+// Commonly used cache line size (x86, most of ARM)
+static constexpr std::size_t CACHE_LINE_SIZE = 64;
+
+// How far (in bytes) ahead of the current record data is requested
+static constexpr std::size_t DISTANCE_BYTES = 512;
+
+// Distance (in records), for records with given stride. At least 1 record
+// (also for empty records, which take 0 bytes)
+template <std::size_t STRIDE>
+constexpr std::size_t records_ahead() {
+    return ((STRIDE == 0) || (STRIDE >= DISTANCE_BYTES)) ? 1 : (DISTANCE_BYTES / STRIDE);
+}
+
+// Prefetch single memory location for reading
+inline void prefetch_for_read(const void* ptr)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(ptr, /* rw= */ 0, /* locality= */ 3);
+#else
+    (void) ptr;
+#endif
+}
+
+// Prefetch each cache line of `BYTES_COUNT`-sized block. Loop bounds known in
+// compile-time, so it is completely unrolled by compiler.
+template <std::size_t BYTES_COUNT>
+inline void prefetch_bytes(const void* ptr)
+{
+    const char* bytes = static_cast<const char*>(ptr);
+    for(std::size_t i = 0; i < BYTES_COUNT; i += CACHE_LINE_SIZE) {
+        prefetch_for_read(bytes + i);
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+#if defined(CT_ENABLE_TESTS)
+namespace tests {
+
+    static_assert( records_ahead<0>()    == 1, "Test failed");
+    static_assert( records_ahead<1>()    == DISTANCE_BYTES, "Test failed");
+    static_assert( records_ahead<16>()   == (DISTANCE_BYTES / 16), "Test failed");
+    static_assert( records_ahead<4096>() == 1, "Test failed");
+
+} // namespace tests
+#endif // defined(CT_ENABLE_TESTS)
+
+} // namespace prefetch
+
+} // namespace utils
+
+} // namespace serialization
+
+} // namespace ct
+
+#endif // CT__SERIALIZATION__UTILS__PREFETCH_HPP
@@ -2,6 +2,8 @@
 #define CT__UTILS__ACCUMULATE_HPP
 
 #include <array> // for std::array<T, SIZE>
+#include <cstddef> // for std::size_t
+#include <initializer_list>
 
 namespace ct {
 
@@ -11,27 +13,61 @@ namespace utils {
     Note: implementation inspired by:
         - https://stackoverflow.com/a/42223988/
         - https://en.cppreference.com/w/cpp/algorithm/accumulate
+
+    Range is summed by splitting into halves (instead of item-by-item), so
+    constexpr evaluation depth is `log2(SIZE)` - not limited by
+    `-fconstexpr-depth` even for arrays with thousands of items.
+
+    Items in range `[idx, SIZE)` are summed, `init` is added at the end.
 */
 
+namespace impl {
+
+template <typename Items, typename T>
+constexpr T accumulate_range(const Items& items, std::size_t first, std::size_t last)
+{
+    return ((last - first) == 1) ? items[first] :
+        ( accumulate_range<Items, T>(items, first, first + ((last - first) / 2)) + accumulate_range<Items, T>(items, first + ((last - first) / 2), last) );
+}
+
+template <typename Items, typename T>
+constexpr T accumulate(const Items& items, std::size_t size, const T& init, std::size_t idx)
+{
+    return (idx < size) ? (accumulate_range<Items, T>(items, idx, size) + init) : init;
+}
+
+// std::initializer_list has no `operator []`
+template <typename T>
+struct list_items
+{
+    const T* items;
+
+    constexpr const T& operator [](std::size_t idx) const {
+        return items[idx];
+    }
+};
+
+} // namespace impl
+
 // Overloading for raw array
 template <typename T, std::size_t SIZE>
 constexpr T accumulate(const T (&array)[SIZE], const T& init, std::size_t idx = 0U)
 {
-    return (idx < SIZE) ? (array[idx] + accumulate<T, SIZE>(array, init, idx+1U)) : init;
+    return impl::accumulate<T[SIZE], T>(array, SIZE, init, idx);
 }
 
 // Overloading for std::array
 template <typename T, std::size_t SIZE>
 constexpr T accumulate(const std::array<T, SIZE>& array, const T& init, std::size_t idx = 0U)
 {
-    return (idx < SIZE) ? (array[idx] + accumulate<T, SIZE>(array, init, idx+1U)) : init;
+    return impl::accumulate<std::array<T, SIZE>, T>(array, SIZE, init, idx);
 }
 
 // Overloading for std::initializer_list
 template <typename T>
 constexpr T accumulate(const std::initializer_list<T>& list, const T& init, std::size_t idx = 0U)
 {
-    return (idx < list.size()) ? ( *(list.begin() + idx) + accumulate<T>(list, init, idx+1U)) : init;
+    return impl::accumulate<impl::list_items<T>, T>(impl::list_items<T>{ list.begin() }, list.size(), init, idx);
 }
 
 // -----------------------------------------------------------------------------
@@ -55,6 +91,11 @@ namespace tests {
     static_assert( accumulate( std::initializer_list<int>{1, 2, 3, 4, 5}, 0) == (1+2+3+4+5)+0, "Test failed");
     static_assert( accumulate( std::initializer_list<int>{1, 2, 3, 4, 5}, 6) == (1+2+3+4+5)+6, "Test failed");
 
+    // Start index & empty ranges
+    static_assert( accumulate( std::array<int, 5>{1, 2, 3, 4, 5}, 0, 3) == (4+5)+0, "Test failed");
+    static_assert( accumulate( std::array<int, 5>{1, 2, 3, 4, 5}, 6, 5) == 6, "Test failed");
+    static_assert( accumulate( std::array<int, 0>{}, 6) == 6, "Test failed");
+
 } // namespace tests
 #endif // defined(CT_ENABLE_TESTS)
 
@@ -0,0 +1,323 @@
+#ifndef CT__UTILS__BYTE_ORDER_HPP
+#define CT__UTILS__BYTE_ORDER_HPP
+
+#include <cstdint> // for std::uint16_t, std::uint32_t, std::uint64_t
+#include <cstring> // for std::memcpy()
+#include <type_traits> // for std::integral_constant<T, V>, std::is_scalar<T>::value
+#include <array> // for std::array<T, N>
+
+#include "ct/utils/ct_utils_constexpr.hpp"
+
+#if defined(__SSSE3__)
+    #include <tmmintrin.h> // for _mm_shuffle_epi8()
+#elif defined(__ARM_NEON)
+    #include <arm_neon.h> // for vrev16q_u8(), vrev32q_u8(), vrev64q_u8()
+#endif
+
+#if defined(_MSC_VER)
+    #include <stdlib.h> // for _byteswap_ushort(), _byteswap_ulong(), _byteswap_uint64()
+#endif
+
+namespace ct {
+
+namespace utils {
+
+/**
+    Byte order (endianness) of packed data. Analogue of `std::endian` from C++20.
+
+    `byte_order::native` is equal to one of `little` or `big` - depending on
+    host, so policies with explicitly specified host byte order cost nothing.
+*/
+enum class byte_order
+{
+    little,
+    big,
+
+#if defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+    native = big
+#else
+    native = little // Also for MSVC - all supported targets are little-endian
+#endif
+};
+
+namespace impl {
+
+inline std::uint16_t byte_swap(std::uint16_t value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_bswap16(value);
+#elif defined(_MSC_VER)
+    return _byteswap_ushort(value);
+#else
+    return static_cast<std::uint16_t>((value >> 8) | (value << 8));
+#endif
+}
+
+inline std::uint32_t byte_swap(std::uint32_t value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_bswap32(value);
+#elif defined(_MSC_VER)
+    return _byteswap_ulong(value);
+#else
+    return ((value >> 24) & 0x000000FFu) | ((value >>  8) & 0x0000FF00u) |
+           ((value <<  8) & 0x00FF0000u) | ((value << 24) & 0xFF000000u);
+#endif
+}
+
+inline std::uint64_t byte_swap(std::uint64_t value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_bswap64(value);
+#elif defined(_MSC_VER)
+    return _byteswap_uint64(value);
+#else
+    return (std::uint64_t{ byte_swap(static_cast<std::uint32_t>(value)) } << 32) |
+            std::uint64_t{ byte_swap(static_cast<std::uint32_t>(value >> 32)) };
+#endif
+}
+
+// -----------------------------------------------------------------------------
+
+/**
+    Copies `count` items of `SIZE` bytes each from `src` into `dest`, reversing
+    bytes order of each item. Both pointers may be unaligned.
+
+    Default implementation (for unusual sizes, like `long double`) reverses
+    bytes one-by-one.
+*/
+template <std::size_t SIZE>
+struct swapped_copier
+{
+    static void copy(std::int8_t* dest, const std::int8_t* src, std::size_t count)
+    {
+        for(std::size_t i = 0; i < count; ++i) {
+            for(std::size_t b = 0; b < SIZE; ++b) {
+                dest[(i * SIZE) + b] = src[(i * SIZE) + (SIZE - 1 - b)];
+            }
+        }
+    }
+
+    // The same, but in place
+    static void swap(std::int8_t* items, std::size_t count)
+    {
+        for(std::size_t i = 0; i < count; ++i) {
+            for(std::size_t b = 0; b < (SIZE / 2); ++b) {
+                const std::int8_t byte = items[(i * SIZE) + b];
+                items[(i * SIZE) + b] = items[(i * SIZE) + (SIZE - 1 - b)];
+                items[(i * SIZE) + (SIZE - 1 - b)] = byte;
+            }
+        }
+    }
+};
+
+// Single-byte items has nothing to swap
+template <>
+struct swapped_copier<1>
+{
+    static void copy(std::int8_t* dest, const std::int8_t* src, std::size_t count) {
+        std::memcpy(dest, src, count);
+    }
+
+    static void swap(std::int8_t* , std::size_t )
+    {}
+};
+
+// Common implementation for 2, 4 & 8 bytes items
+template <std::size_t SIZE, typename UInt>
+struct swapped_integral_copier
+{
+    // Tail (or whole range, without SIMD) - item-by-item. Written in way, which
+    // is easy to auto-vectorize by compiler.
+    static void copy_items(std::int8_t* dest, const std::int8_t* src, std::size_t count)
+    {
+        for(std::size_t i = 0; i < count; ++i)
+        {
+            UInt value;
+            std::memcpy(&value, src + (i * SIZE), SIZE);
+            value = byte_swap(value);
+            std::memcpy(dest + (i * SIZE), &value, SIZE);
+        }
+    }
+
+    static void copy(std::int8_t* dest, const std::int8_t* src, std::size_t count)
+    {
+        constexpr std::size_t BLOCK_SIZE = 16; // Bytes in single SIMD register
+        constexpr std::size_t BLOCK_ITEMS = (BLOCK_SIZE / SIZE);
+
+        std::size_t i = 0;
+
+#if defined(__SSSE3__)
+        // Shuffle mask, which reverses bytes inside of each SIZE-bytes item
+        const __m128i mask =
+              (SIZE == 2) ? _mm_setr_epi8(1,0, 3,2, 5,4, 7,6, 9,8, 11,10, 13,12, 15,14)
+            : (SIZE == 4) ? _mm_setr_epi8(3,2,1,0, 7,6,5,4, 11,10,9,8, 15,14,13,12)
+            :               _mm_setr_epi8(7,6,5,4,3,2,1,0, 15,14,13,12,11,10,9,8);
+
+        for(; (i + BLOCK_ITEMS) <= count; i += BLOCK_ITEMS)
+        {
+            const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + (i * SIZE)));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dest + (i * SIZE)), _mm_shuffle_epi8(block, mask));
+        }
+#elif defined(__ARM_NEON)
+        for(; (i + BLOCK_ITEMS) <= count; i += BLOCK_ITEMS)
+        {
+            const uint8x16_t block = vld1q_u8(reinterpret_cast<const std::uint8_t*>(src + (i * SIZE)));
+            vst1q_u8(reinterpret_cast<std::uint8_t*>(dest + (i * SIZE)),
+                     (SIZE == 2) ? vrev16q_u8(block) : (SIZE == 4) ? vrev32q_u8(block) : vrev64q_u8(block));
+        }
+#else
+        (void) BLOCK_ITEMS;
+#endif
+
+        copy_items(dest + (i * SIZE), src + (i * SIZE), (count - i));
+    }
+
+    // Each block (or item) is loaded before it is stored, so it may be copied
+    // in place
+    static void swap(std::int8_t* items, std::size_t count) {
+        copy(items, items, count);
+    }
+};
+
+template <>
+struct swapped_copier<2> : swapped_integral_copier<2, std::uint16_t> {};
+
+template <>
+struct swapped_copier<4> : swapped_integral_copier<4, std::uint32_t> {};
+
+template <>
+struct swapped_copier<8> : swapped_integral_copier<8, std::uint64_t> {};
+
+} // namespace impl
+
+// -----------------------------------------------------------------------------
+
+/**
+    Copying of scalar values between memory and bytes buffer, with conversion
+    into specified byte order. The same function used for packing & unpacking,
+    since bytes reversing is symmetric.
+
+    For `byte_order::native` it is plain `std::memcpy()`, so there is no any
+    runtime overhead. Otherwise - bytes of each item swapped, by using SIMD
+    shuffles (when available) for arrays of values.
+
+    @code{.cpp}
+    std::uint32_t values[3] = {1, 2, 3};
+    std::int8_t bytes[sizeof(values)];
+
+    ct::utils::byte_order_utils<ct::utils::byte_order::big>::copy<std::uint32_t>(bytes, values, 3);
+    @endcode
+*/
+template <byte_order ORDER>
+struct byte_order_utils
+{
+    static constexpr bool is_native = (ORDER == byte_order::native);
+
+    template <typename T>
+    static void copy(void* dest, const void* src, std::size_t count)
+    {
+        static_assert(std::is_scalar<T>::value == true, "T must be a scalar type");
+
+        copy_impl<T>(dest, src, count, std::integral_constant<bool, is_native>{});
+    }
+
+    // Converts `count` items in place (from or into `ORDER`) - for items, which
+    // were copied as-is. For native byte order - does nothing
+    template <typename T>
+    static void swap_in_place(T* items, std::size_t count)
+    {
+        static_assert(std::is_scalar<T>::value == true, "T must be a scalar type");
+
+        swap_in_place_impl<T>(items, count, std::integral_constant<bool, is_native>{});
+    }
+
+    // -------------------------------------------------------------------------
+    // Typed versions of `copy()`, usable in constant expressions (when
+    // `CT_HAS_CONSTEXPR_PACKING` is enabled), since `void*` cannot be casted
+    // there
+
+    // Values --> bytes
+    template <typename T>
+    static CT_CONSTEXPR_PACKING void store(std::int8_t* dest, const T* items, std::size_t count)
+    {
+#if CT_HAS_CONSTEXPR_PACKING
+        if(std::is_constant_evaluated())
+        {
+            for(std::size_t i = 0; i < count; ++i)
+            {
+                const auto bytes = std::bit_cast< std::array<std::int8_t, sizeof(T)> >(items[i]);
+                for(std::size_t b = 0; b < sizeof(T); ++b) {
+                    dest[(i * sizeof(T)) + b] = bytes[is_native ? b : (sizeof(T) - 1 - b)];
+                }
+            }
+            return;
+        }
+#endif
+        copy<T>(dest, items, count);
+    }
+
+    // Bytes --> values
+    template <typename T>
+    static CT_CONSTEXPR_PACKING void load(T* items, const std::int8_t* src, std::size_t count)
+    {
+#if CT_HAS_CONSTEXPR_PACKING
+        if(std::is_constant_evaluated())
+        {
+            for(std::size_t i = 0; i < count; ++i)
+            {
+                std::array<std::int8_t, sizeof(T)> bytes {};
+                for(std::size_t b = 0; b < sizeof(T); ++b) {
+                    bytes[is_native ? b : (sizeof(T) - 1 - b)] = src[(i * sizeof(T)) + b];
+                }
+                items[i] = std::bit_cast<T>(bytes);
+            }
+            return;
+        }
+#endif
+        copy<T>(items, src, count);
+    }
+
+private:
+
+    template <typename T>
+    static void copy_impl(void* dest, const void* src, std::size_t count, std::true_type /* is_native */)
+    {
+        std::memcpy(dest, src, count * sizeof(T));
+    }
+
+    template <typename T>
+    static void copy_impl(void* dest, const void* src, std::size_t count, std::false_type /* is_native */)
+    {
+        impl::swapped_copier< sizeof(T) >::copy(static_cast<std::int8_t*>(dest), static_cast<const std::int8_t*>(src), count);
+    }
+
+    template <typename T>
+    static void swap_in_place_impl(T* , std::size_t , std::true_type /* is_native */)
+    {}
+
+    template <typename T>
+    static void swap_in_place_impl(T* items, std::size_t count, std::false_type /* is_native */)
+    {
+        impl::swapped_copier< sizeof(T) >::swap(reinterpret_cast<std::int8_t*>(items), count);
+    }
+};
+
+// -----------------------------------------------------------------------------
+
+#if defined(CT_ENABLE_TESTS)
+namespace tests {
+
+    static_assert( (byte_order::native == byte_order::little) || (byte_order::native == byte_order::big), "Test failed");
+
+    static_assert( byte_order_utils<byte_order::native>::is_native == true, "Test failed");
+    static_assert( byte_order_utils<byte_order::little>::is_native != byte_order_utils<byte_order::big>::is_native, "Test failed");
+
+} // namespace tests
+#endif // defined(CT_ENABLE_TESTS)
+
+} // namespace utils
+
+} // namespace ct
+
+#endif // CT__UTILS__BYTE_ORDER_HPP
@@ -0,0 +1,46 @@
+#ifndef CT__UTILS__CONSTEXPR_HPP
+#define CT__UTILS__CONSTEXPR_HPP
+
+/**
+    Detection of compile-time packing support.
+
+    Packing & unpacking copies bytes of scalar values, which is possible at
+    compile-time only by `std::bit_cast()` (C++20) - `std::memcpy()` and
+    `reinterpret_cast<>` are not allowed in constant expressions. So:
+
+    - `CT_HAS_CONSTEXPR_PACKING` - `1` if `std::bit_cast()` and
+      `std::is_constant_evaluated()` are available, otherwise `0`.
+    - `CT_CONSTEXPR_PACKING` - `constexpr` if packing is possible at
+      compile-time, otherwise nothing (C++11 .. C++17 path, as before).
+
+    Also detection of relaxed constexpr (C++14): `CT_HAS_RELAXED_CONSTEXPR` -
+    `1` if loops & local variables are allowed in constexpr functions, so
+    compile-time calculations (like offsets) may be done in single pass,
+    instead of recursion.
+*/
+
+#if defined(__has_include)
+    #if __has_include(<version>)
+        #include <version> // for __cpp_lib_bit_cast, __cpp_lib_is_constant_evaluated
+    #endif
+#endif
+
+#if defined(__cpp_constexpr) && (__cpp_constexpr >= 201304L)
+    #define CT_HAS_RELAXED_CONSTEXPR 1
+#else
+    #define CT_HAS_RELAXED_CONSTEXPR 0
+#endif
+
+#if defined(__cpp_lib_bit_cast) && (__cpp_lib_bit_cast >= 201806L) && \
+    defined(__cpp_lib_is_constant_evaluated) && (__cpp_lib_is_constant_evaluated >= 201811L)
+    #define CT_HAS_CONSTEXPR_PACKING 1
+    #define CT_CONSTEXPR_PACKING constexpr
+
+    #include <bit>         // for std::bit_cast<T>()
+    #include <type_traits> // for std::is_constant_evaluated()
+#else
+    #define CT_HAS_CONSTEXPR_PACKING 0
+    #define CT_CONSTEXPR_PACKING
+#endif
+
+#endif // CT__UTILS__CONSTEXPR_HPP
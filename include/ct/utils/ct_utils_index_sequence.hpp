@@ -1,6 +1,10 @@
 #ifndef CT__UTILS__INDEX_SEQUENCE_HPP
 #define CT__UTILS__INDEX_SEQUENCE_HPP
 
+#if defined(CT_ENABLE_TESTS)
+    #include <type_traits> // for std::is_base_of<B, D>::value, std::is_same<T, U>::value
+#endif
+
 namespace ct {
 
 /**
@@ -9,21 +13,112 @@ namespace ct {
     - `ct::int_seq::index`   - analogue of `std::integer_sequnece<std::size_t ...>`
     - `ct::int_seq::gen_seq` - analogue of `std::make_index_sequence<std::size_t N>`
 
+    `gen_seq<N>` is generated by compiler builtin (`__make_integer_seq` for
+    clang & msvc, `__integer_pack` for gcc), if available. Otherwise - by
+    splitting into halves, so instantiation depth is `log2(N)` instead of `N`
+    (important for arrays with thousands of items).
+
     TODO:
         - add references
-        - add tests
 */
 
+#if defined(__has_builtin)
+    #if __has_builtin(__make_integer_seq)
+        #define CT_HAS_BUILTIN_MAKE_INTEGER_SEQ 1
+    #elif __has_builtin(__integer_pack)
+        #define CT_HAS_BUILTIN_INTEGER_PACK 1
+    #endif
+
+    // Also used for type-lists algorithms
+    #if __has_builtin(__type_pack_element)
+        #define CT_HAS_BUILTIN_TYPE_PACK_ELEMENT 1
+    #endif
+#elif defined(_MSC_VER) && (_MSC_VER >= 1900)
+    #define CT_HAS_BUILTIN_MAKE_INTEGER_SEQ 1
+#elif defined(__GNUC__) && (__GNUC__ >= 8)
+    #define CT_HAS_BUILTIN_INTEGER_PACK 1
+#endif
+
 namespace ind_seq {
 
 template <int... Is>
 struct index {};
 
-template <int N, int... Is>
-struct gen_seq : gen_seq<N - 1, N - 1, Is...> { };
+namespace impl {
 
-template <int... Is>
-struct gen_seq<0, Is...> : index<Is...> { };
+#if defined(CT_HAS_BUILTIN_MAKE_INTEGER_SEQ)
+
+template <typename T, T ... Is>
+struct index_maker {
+    using type = index<Is...>;
+};
+
+template <int N>
+struct make_index {
+    using type = typename __make_integer_seq<index_maker, int, N>::type;
+};
+
+#elif defined(CT_HAS_BUILTIN_INTEGER_PACK)
+
+template <int N>
+struct make_index {
+    using type = index<__integer_pack(N)...>;
+};
+
+#else
+
+// Concatenates two sequences, shifting second by length of first:
+// <0, 1, 2> + <0, 1, 2> --> <0, 1, 2, 3, 4, 5>
+template <typename Left, typename Right>
+struct concat_shifted;
+
+template <int ... Ls, int ... Rs>
+struct concat_shifted< index<Ls...>, index<Rs...> > {
+    using type = index<Ls..., (static_cast<int>(sizeof...(Ls)) + Rs)...>;
+};
+
+template <int N>
+struct make_index {
+    using type = typename concat_shifted<
+        typename make_index<(N / 2)>::type,
+        typename make_index<(N - (N / 2))>::type
+    >::type;
+};
+
+template <>
+struct make_index<0> {
+    using type = index<>;
+};
+
+template <>
+struct make_index<1> {
+    using type = index<0>;
+};
+
+#endif
+
+} // namespace impl
+
+template <int N>
+struct gen_seq : impl::make_index<N>::type { };
+
+// Exactly `index<0, 1, ..., N-1>` (not derived from it, like `gen_seq<N>`) -
+// for matching by partial specializations
+template <int N>
+using make_index_t = typename impl::make_index<N>::type;
+
+#if defined(CT_ENABLE_TESTS)
+namespace tests {
+
+    static_assert(std::is_base_of< index<>,        gen_seq<0> >::value, "Test failed");
+    static_assert(std::is_base_of< index<0>,       gen_seq<1> >::value, "Test failed");
+    static_assert(std::is_base_of< index<0, 1, 2>, gen_seq<3> >::value, "Test failed");
+    static_assert(std::is_base_of< index<0, 1, 2, 3, 4, 5, 6>, gen_seq<7> >::value, "Test failed");
+
+    static_assert(std::is_same< index<0, 1, 2, 3, 4>, make_index_t<5> >::value, "Test failed");
+
+} // namespace tests
+#endif // defined(CT_ENABLE_TESTS)
 
 } // namespace ind_seq
 
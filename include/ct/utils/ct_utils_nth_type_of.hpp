@@ -1,9 +1,10 @@
 #ifndef CT__UTILS__NTH_TYPE_OF_HPP
 #define CT__UTILS__NTH_TYPE_OF_HPP
 
-#if defined(CT_ENABLE_TESTS)
-    #include <type_traits> // for std::is_same<T, U>::value
-#endif
+#include "ct/utils/typelist/ct_utils_typelist_skip_types.hpp" // for impl::type_wrapper<T>
+#include "ct/utils/ct_utils_index_sequence.hpp" // also for CT_HAS_BUILTIN_TYPE_PACK_ELEMENT
+
+#include <type_traits> // for std::conditional<B, T, F>, std::is_same<T, U>::value
 
 namespace ct {
 
@@ -15,6 +16,10 @@ namespace utils {
     Renamed from original `tuple_element` name into `nth_type_of`, since it not
     about tuples, but about type-lists.
 
+    Originally implemented recursively (instantiation depth was `N`), now - by
+    compiler builtin `__type_pack_element` (if available), or by overload
+    resolution without recursion over types.
+
     Note: this is kinda-lighweight version of `std::tuple_element`, and may be
     implemented much simpler (https://stackoverflow.com/a/29753388/):
     @code{.cpp}
@@ -24,26 +29,58 @@ namespace utils {
     @endcode
 */
 
+namespace impl {
+
+#if defined(CT_HAS_BUILTIN_TYPE_PACK_ELEMENT)
+
 template <int N, typename ... Types>
-struct nth_type_of {};
+struct nth_type_of_impl {
+    using type = __type_pack_element<N, Types...>;
+};
+
+#else
 
-// Specialization for 0 index - end recursion ang give first type
-template <typename T0, typename... Types>
-struct nth_type_of<0, T0, Types...> {
-    using type = T0 ;
+// The same trick, as for `skip_types`: first `N` pointers consumed by `void*`
+// parameters, the next one - is the wanted type, others - by ellipsis. So
+// there is no recursion over types.
+template <typename Index>
+struct nth_selector;
+
+template <int ... Is>
+struct nth_selector< ct::ind_seq::index<Is...> >
+{
+    template <typename T>
+    static type_wrapper<T> select(decltype((void) Is, static_cast<void*>(nullptr)) ..., type_wrapper<T>*, ...);
 };
 
-template <int N, typename T0, typename... Types>
-struct nth_type_of<N, T0, Types...> {
-    using type = typename nth_type_of<(N-1), Types...>::type;
+template <int N, typename ... Types>
+struct nth_type_of_impl {
+    using type = typename decltype( nth_selector< ct::ind_seq::make_index_t<N> >::select( static_cast< type_wrapper<Types>* >(nullptr) ... ) )::type;
 };
 
+#endif
+
+struct no_type {};
+
+} // namespace impl
+
+// Out of range `N` gives no `type`
+template <int N, typename ... Types>
+struct nth_type_of
+        : std::conditional<
+            ((N >= 0) && (N < static_cast<int>(sizeof...(Types)))),
+            impl::nth_type_of_impl<N, Types...>,
+            impl::no_type
+          >::type
+{};
+
 #if defined(CT_ENABLE_TESTS)
 namespace tests {
 
     static_assert(std::is_same< nth_type_of<0, bool, int, double>::type,   bool>::value, "Test failed");
     static_assert(std::is_same< nth_type_of<1, bool, int, double>::type,    int>::value, "Test failed");
     static_assert(std::is_same< nth_type_of<2, bool, int, double>::type, double>::value, "Test failed");
+    static_assert(std::is_same< nth_type_of<1, bool, int[3]>::type,     int[3]>::value, "Test failed");
 
 } // namespace tests
 #endif // defined(CT_ENABLE_TESTS)
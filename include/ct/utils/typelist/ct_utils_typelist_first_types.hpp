@@ -2,43 +2,90 @@
 #define CT__UTILS__TYPELIST_FIRST_TYPES_HPP
 
 #include "ct/utils/typelist/ct_utils_typelist.hpp"
+#include "ct/utils/typelist/ct_utils_typelist_skip_types.hpp"
+#include "ct/utils/ct_utils_index_sequence.hpp" // also for CT_HAS_BUILTIN_TYPE_PACK_ELEMENT
 
-#if defined(CT_ENABLE_TESTS)
-    #include <type_traits> // for std::is_same<T, U>::value
-#endif
+#include <type_traits> // for std::conditional<B, T, F>
 
 namespace ct {
 
 namespace utils {
 
-// Based on: https://stackoverflow.com/a/17508225/
+namespace impl {
+
+#if defined(CT_HAS_BUILTIN_TYPE_PACK_ELEMENT)
 
-template<int n, typename In, typename... Out>
+// Each of first `n` types is taken directly by index - without recursion
+template <typename Index, typename T>
 struct first_impl;
 
-template<int n, typename First, typename... Other, typename... Out>
-struct first_impl<n, List<First, Other...>, Out...> {
-    using type = typename first_impl<n - 1, List<Other...>, Out..., First>::type; //move first input to output.
+template <int ... Is, typename ... Types>
+struct first_impl< ct::ind_seq::index<Is...>, List<Types...> > {
+    using type = List< __type_pack_element<Is, Types...> ... >;
+};
+
+template <int n, typename T>
+struct first_selector {
+    using type = typename first_impl< ct::ind_seq::make_index_t<n>, T >::type;
+};
+
+#else
+
+template <typename Head, typename Tail>
+struct concat;
+
+template <typename ... Head, typename ... Tail>
+struct concat< List<Head...>, List<Tail...> > {
+    using type = List<Head..., Tail...>;
 };
 
-//need First, Other... here to resolve ambiguity on n = 0
-template<typename First, typename... Other, typename... Out>
-struct first_impl<0, List<First, Other...>, Out...> {
-    using type = List<Out...> ;  //stop if no more elements needed
+// Splits in halves: first `n/2` types, and first `n - n/2` types of the rest
+// (which are skipped without recursion, see `skip_types`) - so instantiation
+// depth is `log2(n)` instead of `n`
+template <int n, typename T>
+struct first_selector
+{
+    using type = typename concat<
+        typename first_selector< (n / 2), T >::type,
+        typename first_selector< (n - (n / 2)), typename skip_types< (n / 2), T >::type >::type
+    >::type;
 };
 
-// Explicit rule for empty tuple because of First, Other... in the previous rule.
-// actually it's for N == size of tuple
-template <typename ... Out>
-struct first_impl<0, List<>, Out...> {
-    using type = List<Out...>;
+template <typename ... Types>
+struct first_selector< 0, List<Types...> > {
+    using type = List<>;
 };
 
+template <typename First, typename ... Types>
+struct first_selector< 1, List<First, Types...> > {
+    using type = List<First>;
+};
+
+#endif
+
+template <typename T>
+struct identity {
+    using type = T;
+};
+
+} // namespace impl
+
 /// -----------------------
 
+// Takes first `n` types of `List<Types...>`:
+// first_types<2, List<bool, char, int>> --> List<bool, char>
 template<int n, typename T>
-struct first_types {
-    using type = typename first_impl<n, T>::type;
+struct first_types {};
+
+template<int n, typename ... Types>
+struct first_types< n, List<Types...> > {
+    static_assert(n <= static_cast<int>(sizeof...(Types)), "Types count is less than n");
+
+    using type = typename std::conditional<
+        (n == static_cast<int>(sizeof...(Types))),
+        impl::identity< List<Types...> >, // All types - nothing to split
+        impl::first_selector< n, List<Types...> >
+    >::type::type;
 };
 
 // -----------------------------------------------------------------------------
@@ -3,6 +3,8 @@
 
 #include "ct/utils/typelist/ct_utils_typelist_join.hpp"
 
+#include <type_traits> // for std::conditional<B, T, F>, std::is_same<T, U>
+
 namespace ct {
 
 namespace utils {
@@ -19,12 +21,44 @@ struct flatten
     using type = List<T>; // wrap the argument in a `List`
 };
 
+namespace impl {
+
+template <typename T>
+struct is_list : std::false_type {};
+
 template <typename ... Types>
-struct flatten< List<Types...> > // if the argument is a `List` of multiple elements
+struct is_list< List<Types...> > : std::true_type {};
+
+template <bool ... Values>
+struct bools {};
+
+// Without recursion: `true` only if all values are `false` (so shifted pack is
+// the same as original)
+template <typename ... Types>
+struct has_no_lists
+        : std::is_same< bools<false, is_list<Types>::value ...>, bools<is_list<Types>::value ..., false> >
+{};
+
+template <typename ... Types>
+struct flatten_each
 {
-    // Then flatten each element of the `List` argument and join the
-    // resulting `List<..>`s
+    // Flatten each element of the `List` argument and join the resulting
+    // `List<..>`s
     using type = typename join<typename flatten<Types>::type...>::type;
+};
+
+} // namespace impl
+
+template <typename ... Types>
+struct flatten< List<Types...> > // if the argument is a `List` of multiple elements
+{
+    // Already flat list (for example - typical result of `repeat<T, N>`) is
+    // returned as-is, without joining of `N` single-type lists
+    using type = typename std::conditional<
+        impl::has_no_lists<Types...>::value,
+        impl::identity< List<Types...> >,
+        impl::flatten_each<Types...>
+    >::type::type;
 
     // ex. the argument is `List<List<int>, List<double>>`
     // then `TT...` is deduced to `List<int>, List<double>`
@@ -50,6 +84,9 @@ namespace tests {
     // Test for common concatenation
     static_assert( std::is_same< flatten< List< List<bool, short, float>, List<char, int, double> > >::type , List<bool, short, float, char, int, double> >::value, "Test failed");
 
+    // Test for already flat list
+    static_assert( std::is_same< flatten< List<bool, short, float> >::type , List<bool, short, float> >::value, "Test failed");
+
     // Test for flattening multiple nested lists
     static_assert( std::is_same< flatten< List< List< List<bool>, List<short>, List<int> >, List<float, double> > >::type, List<bool, short, int, float, double> >::value, "Test failed");
 
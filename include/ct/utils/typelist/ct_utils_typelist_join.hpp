@@ -2,6 +2,8 @@
 #define CT__UTILS__TYPELIST_JOIN_HPP
 
 #include "ct/utils/typelist/ct_utils_typelist.hpp"
+#include "ct/utils/typelist/ct_utils_typelist_first_types.hpp"
+#include "ct/utils/typelist/ct_utils_typelist_skip_types.hpp"
 
 #if defined(CT_ENABLE_TESTS)
     #include<type_traits> // for std::is_same<T, U>::value
@@ -17,8 +19,39 @@ namespace utils {
 // e.g.    List<TT1...>, List<TT2...>, etc., List<TTN...>
 //      => List<TT1..., TT2..., etc., TTN...>
 // requires: all template arguments are `List<..>`s
+//
+// Lists are joined by halves (divide & conquer), instead of one-by-one, so
+// instantiation depth is `log2(N)` instead of `N` for `N` lists
+template <typename ... Types>
+struct join;
+
+namespace impl {
+
+// The same as `join<Lists...>`, but for lists passed as `List<Lists...>`
+template <typename T>
+struct join_list;
+
+template <typename ... Lists>
+struct join_list< List<Lists...> >
+{
+    using type = typename join<Lists...>::type;
+};
+
+} // namespace impl
+
 template <typename ... Types>
 struct join
+{
+    static constexpr int half = static_cast<int>(sizeof...(Types) / 2);
+
+    using type = typename join<
+        typename impl::join_list< typename first_types<half, List<Types...>>::type >::type,
+        typename impl::join_list< typename skip_types <half, List<Types...>>::type >::type
+    >::type;
+};
+
+template <>
+struct join<>
 {
     using type = List<>; // End recursion for no parameters
 };
@@ -29,15 +62,10 @@ struct join< List<Types...> >
     using type = List<Types...>; // End recursion for a single parameter
 };
 
-template <typename ... TT0, typename ... TT1, typename ... TT2>
-struct join<List<TT0...>, List<TT1...>, TT2...>
+template <typename ... TT0, typename ... TT1>
+struct join< List<TT0...>, List<TT1...> >
 {
-    // Join two adjacent lists into one, recurse by joining the two
-    // lists `List<TT0...>` and `List<TT1...>`, we get one template argument
-    // less for the next instantiation of `join` this recurs until there's
-    // only one argument left, which then matches the
-    // specialization `struct join< List<Types...> >`
-    using type = typename join< List<TT0..., TT1...>, TT2... >::type;
+    using type = List<TT0..., TT1...>; // End recursion for two parameters
 };
 
 #if defined(CT_ENABLE_TESTS)
@@ -54,6 +82,7 @@ namespace tests {
     static_assert(std::is_same< join< List<>, List<bool, float> >::type , List<bool, float> >::value, "Test failed");
 
     // Test for common joining
+    static_assert(std::is_same< join< List<bool>, List<short>, List<float>, List<char>, List<int> >::type , List<bool, short, float, char, int> >::value, "Test failed");
     static_assert(std::is_same< join< List<bool, short, float>, List<char, int, double> >::type , List<bool, short, float, char, int, double> >::value, "Test failed");
 
     // Test for joining multiple nested lists with common types
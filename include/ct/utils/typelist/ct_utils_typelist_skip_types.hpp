@@ -0,0 +1,74 @@
+#ifndef CT__UTILS__TYPELIST_SKIP_TYPES_HPP
+#define CT__UTILS__TYPELIST_SKIP_TYPES_HPP
+
+#include "ct/utils/typelist/ct_utils_typelist.hpp"
+#include "ct/utils/ct_utils_index_sequence.hpp"
+
+#if defined(CT_ENABLE_TESTS)
+    #include <type_traits> // for std::is_same<T, U>::value
+#endif
+
+namespace ct {
+
+namespace utils {
+
+namespace impl {
+
+// Pointer to it is used instead of `T*`, since `T` may be an array, or
+// abstract type
+template <typename T>
+struct type_wrapper {
+    using type = T;
+};
+
+/**
+    Skipping without recursion: first `n` pointers (to wrappers of types) are
+    consumed by `void*` parameters, and rest types are deduced from the rest
+    parameters - so instantiation depth doesn't depend on `n` (except
+    `gen_seq<n>`, which is `log2(n)` or builtin).
+*/
+template <typename Index>
+struct skip_impl;
+
+template <int ... Is>
+struct skip_impl< ct::ind_seq::index<Is...> >
+{
+    template <typename ... Rest>
+    static List<Rest...> select(decltype((void) Is, static_cast<void*>(nullptr)) ..., type_wrapper<Rest>* ...);
+};
+
+} // namespace impl
+
+// Drops first `n` types of `List<Types...>`:
+// skip_types<2, List<bool, char, int>> --> List<int>
+template<int n, typename T>
+struct skip_types {};
+
+template<int n, typename ... Types>
+struct skip_types< n, List<Types...> >
+{
+    static_assert(n <= static_cast<int>(sizeof...(Types)), "Types count is less than n");
+
+    using type = decltype( impl::skip_impl< ct::ind_seq::make_index_t<n> >::select( static_cast< impl::type_wrapper<Types>* >(nullptr) ... ) );
+};
+
+// -----------------------------------------------------------------------------
+
+#if defined(CT_ENABLE_TESTS)
+namespace tests {
+
+    static_assert(std::is_same< skip_types<0, List<> >::type, List<> >::value, "Test failed");
+    static_assert(std::is_same< skip_types<0, List<bool, char, int, float> >::type, List<bool, char, int, float> >::value, "Test failed");
+    static_assert(std::is_same< skip_types<1, List<bool, char, int, float> >::type, List<char, int, float> >::value, "Test failed");
+    static_assert(std::is_same< skip_types<3, List<bool, char, int, float> >::type, List<float> >::value, "Test failed");
+    static_assert(std::is_same< skip_types<4, List<bool, char, int, float> >::type, List<> >::value, "Test failed");
+    static_assert(std::is_same< skip_types<1, List<bool, int[3]> >::type, List<int[3]> >::value, "Test failed");
+
+} // namespace tests
+#endif // defined(CT_ENABLE_TESTS)
+
+} // namespace utils
+
+} // namespace ct
+
+#endif // CT__UTILS__TYPELIST_SKIP_TYPES_HPP
@@ -1,11 +1,18 @@
 INCLUDEPATH += $$PWD
 
 HEADERS += \
+    $$PWD/rt/serialization/rt_serialization_arena.hpp \
     $$PWD/rt/serialization/rt_serialization_bytes_count.hpp \
     $$PWD/rt/serialization/rt_serialization_bytes_count_stl.hpp \
+    $$PWD/rt/serialization/rt_serialization_members.hpp \
     $$PWD/rt/serialization/rt_serialization_pack.hpp \
     $$PWD/rt/serialization/rt_serialization_pack_stl.hpp \
+    $$PWD/rt/serialization/rt_serialization_policy.hpp \
+    $$PWD/rt/serialization/rt_serialization_rope_writer.hpp \
     $$PWD/rt/serialization/rt_serialization_unpack.hpp \
     $$PWD/rt/serialization/rt_serialization_unpack_stl.hpp \
+    $$PWD/rt/serialization/rt_serialization_varint.hpp \
+    $$PWD/rt/serialization/rt_serialization_views.hpp \
+    $$PWD/rt/serialization/rt_serialization_writer.hpp \
     $$PWD/rt/serialization/rt_serialization_stl_collection_size.hpp
 
@@ -0,0 +1,228 @@
+#ifndef RT__SERIALIZATION__ARENA_HPP
+#define RT__SERIALIZATION__ARENA_HPP
+
+#include <cstddef> // for std::size_t, std::max_align_t
+#include <cstdint> // for std::uintptr_t
+#include <memory>  // for std::unique_ptr<T>
+#include <type_traits>
+#include <vector>
+
+#include <deque>
+#include <forward_list>
+#include <list>
+
+#if defined(__has_include)
+    #if (__cplusplus >= 201703L) && __has_include(<memory_resource>)
+        #include <memory_resource>
+    #endif
+#endif
+
+/**
+    Monotonic arena for decoding of messages - containers of decoded values
+    take memory from few big blocks, which are reused for the next message
+    after `reset()` (instead of many heap allocations per message):
+
+    @code{.cpp}
+    rt::serialization::arena memory;
+
+    for(const message_t& message : messages)
+    {
+        {
+            rt::serialization::arena_vector< rt::serialization::arena_vector<float> > values( rt::serialization::make_arena_allocator(memory) );
+            rt::serialization::unpack(message.data(), values);
+
+            process(values);
+        } // Values must be destroyed before reset
+
+        memory.reset();
+    }
+    @endcode
+
+    - `RT_SERIALIZATION_HAS_PMR` - `1` if `std::pmr` is available (C++17),
+      otherwise `0`. Arena is `std::pmr::memory_resource` in that case, and
+      `arena_allocator<T>` is `std::pmr::polymorphic_allocator<T>` (so arena
+      containers are `std::pmr` containers). Otherwise `arena_allocator<T>` is
+      bundled `basic_arena_allocator<T>` in `std::scoped_allocator_adaptor`.
+    - Either way allocator is passed to nested containers (and `std::pair`,
+      `std::tuple` items), which are created during unpacking.
+    - Memory is not freed by containers (deallocation is no-op), only by arena.
+*/
+
+#if defined(__cpp_lib_memory_resource) && (__cpp_lib_memory_resource >= 201603L)
+    #define RT_SERIALIZATION_HAS_PMR 1
+#else
+    #define RT_SERIALIZATION_HAS_PMR 0
+    #include <scoped_allocator>
+#endif
+
+namespace rt {
+
+namespace serialization {
+
+class arena
+#if RT_SERIALIZATION_HAS_PMR
+        : public std::pmr::memory_resource
+#endif
+{
+public:
+    static constexpr std::size_t default_block_size = 64 * 1024;
+
+    explicit arena(std::size_t block_size = default_block_size)
+        : m_block_size(block_size)
+    {}
+
+    arena(const arena& ) = delete;
+    arena& operator=(const arena& ) = delete;
+
+    // Note: alignment must be power of 2
+    void* allocate_bytes(std::size_t count, std::size_t alignment = alignof(std::max_align_t))
+    {
+        for(; m_current < m_blocks.size(); ++m_current, m_offset = 0)
+        {
+            const block& item = m_blocks[m_current];
+            const std::size_t begin = aligned_offset(item, m_offset, alignment);
+
+            if((begin <= item.size) && (count <= (item.size - begin))) {
+                m_offset = begin + count;
+                return item.data.get() + begin;
+            }
+        }
+
+        // No space in existing blocks - new one (at least for that allocation)
+        const std::size_t size = (count + alignment > m_block_size) ? (count + alignment) : m_block_size;
+        m_blocks.push_back( block{ std::unique_ptr<unsigned char[]>( new unsigned char[size] ), size } );
+        m_current = m_blocks.size() - 1;
+
+        const block& item = m_blocks.back();
+        const std::size_t begin = aligned_offset(item, 0, alignment);
+        m_offset = begin + count;
+        return item.data.get() + begin;
+    }
+
+    // All allocated memory may be reused (blocks are kept)
+    void reset()
+    {
+        m_current = 0;
+        m_offset = 0;
+    }
+
+    // Total bytes count of blocks
+    std::size_t capacity() const
+    {
+        std::size_t count = 0;
+        for(const block& item : m_blocks) {
+            count += item.size;
+        }
+        return count;
+    }
+
+private:
+    struct block
+    {
+        std::unique_ptr<unsigned char[]> data;
+        std::size_t size;
+    };
+
+    static std::size_t aligned_offset(const block& item, std::size_t offset, std::size_t alignment)
+    {
+        const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(item.data.get()) + offset;
+        return offset + ((alignment - (address & (alignment - 1))) & (alignment - 1));
+    }
+
+#if RT_SERIALIZATION_HAS_PMR
+    void* do_allocate(std::size_t count, std::size_t alignment) override {
+        return allocate_bytes(count, alignment);
+    }
+
+    void do_deallocate(void* , std::size_t , std::size_t ) override
+    {}
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return (this == &other);
+    }
+#endif
+
+    std::size_t m_block_size;
+    std::vector<block> m_blocks;
+    std::size_t m_current = 0;
+    std::size_t m_offset = 0;
+};
+
+// Minimal allocator, which takes memory from arena
+template <typename T>
+class basic_arena_allocator
+{
+public:
+    using value_type = T;
+
+    basic_arena_allocator(arena& memory) noexcept
+        : m_arena(&memory)
+    {}
+
+    template <typename U>
+    basic_arena_allocator(const basic_arena_allocator<U>& other) noexcept
+        : m_arena(&other.get_arena())
+    {}
+
+    T* allocate(std::size_t count) {
+        return static_cast<T*>( m_arena->allocate_bytes(sizeof(T) * count, alignof(T)) );
+    }
+
+    void deallocate(T* , std::size_t ) noexcept
+    {}
+
+    arena& get_arena() const noexcept {
+        return *m_arena;
+    }
+
+private:
+    arena* m_arena;
+};
+
+template <typename T, typename U>
+inline bool operator==(const basic_arena_allocator<T>& l, const basic_arena_allocator<U>& r) noexcept {
+    return (&l.get_arena() == &r.get_arena());
+}
+
+template <typename T, typename U>
+inline bool operator!=(const basic_arena_allocator<T>& l, const basic_arena_allocator<U>& r) noexcept {
+    return !(l == r);
+}
+
+// -----------------------------------------------------------------------------
+
+#if RT_SERIALIZATION_HAS_PMR
+template <typename T>
+using arena_allocator = std::pmr::polymorphic_allocator<T>;
+#else
+template <typename T>
+using arena_allocator = std::scoped_allocator_adaptor< basic_arena_allocator<T> >;
+#endif
+
+template <typename T = std::int8_t>
+inline arena_allocator<T> make_arena_allocator(arena& memory)
+{
+#if RT_SERIALIZATION_HAS_PMR
+    return arena_allocator<T>(&memory);
+#else
+    return arena_allocator<T>( basic_arena_allocator<T>(memory) );
+#endif
+}
+
+template <typename T>
+using arena_vector = std::vector< T, arena_allocator<T> >;
+
+template <typename T>
+using arena_deque = std::deque< T, arena_allocator<T> >;
+
+template <typename T>
+using arena_forward_list = std::forward_list< T, arena_allocator<T> >;
+
+template <typename T>
+using arena_list = std::list< T, arena_allocator<T> >;
+
+} // namespace serialization
+
+} // namespace rt
+
+#endif // RT__SERIALIZATION__ARENA_HPP
@@ -1,6 +1,7 @@
 #ifndef RT__SERIALIZATION__BYTES_COUNT_HPP
 #define RT__SERIALIZATION__BYTES_COUNT_HPP
 
+#include <cstddef> // for std::size_t
 #include <type_traits> // for std::enable_if<T>::type, std::is_scalar<T>::value
 
 namespace rt {
@@ -12,7 +13,9 @@ namespace serialization {
     bytes count. For example, for `std::vector<int>` it returns not:
         `vector.size() * sizeof(int)`
     but:
-        `sizeof(collection_size_t) + ( vector.size() * sizeof(int) )`
+        `sizeof(size_type) + ( vector.size() * sizeof(int) )`
+    (where `size_type` is packed size type of container, see
+    `stl::collection_size_trait`)
 
     Be careful - this trait used for calculating necessary bytes buffer size,
     with all needed EXTRA space for meta-data (like collection sizes). This is
@@ -40,6 +43,62 @@ struct bytes_count_trait<T, typename std::enable_if< std::is_scalar<T>::value ==
     }
 };
 
+// -----------------------------------------------------------------------------
+
+/**
+    Packed bytes count, which is the same for all values of `T` - known at
+    compile-time (scalars, and `std::array`, `std::pair`, `std::tuple` of such
+    types). Containers of such items are counted in closed form:
+    `sizeof(size_type) + size() * bytes_count`, without walking
+    through their items.
+
+    For types of variable size (like `std::vector<T>`) and custom types
+    without specialization: `is_fixed == false`.
+*/
+template <typename T, typename Enabled = void>
+struct fixed_bytes_count_trait
+{
+    static constexpr bool is_fixed = false;
+    static constexpr std::size_t bytes_count = 0;
+};
+
+template <typename T>
+struct fixed_bytes_count_trait<T, typename std::enable_if< std::is_scalar<T>::value == true >::type >
+{
+    static constexpr bool is_fixed = true;
+    static constexpr std::size_t bytes_count = sizeof(T);
+};
+
+namespace impl {
+
+template <typename T, typename InputIt>
+inline std::size_t items_bytes_count(InputIt first, InputIt last, std::size_t , std::false_type /* is_fixed */)
+{
+    std::size_t count = 0;
+    for(; first != last; ++first) {
+        count += bytes_count_trait<T>::bytes_count(*first);
+    }
+    return count;
+}
+
+template <typename T, typename InputIt>
+inline std::size_t items_bytes_count(InputIt , InputIt , std::size_t size, std::true_type /* is_fixed */)
+{
+    return size * fixed_bytes_count_trait<T>::bytes_count;
+}
+
+} // namespace impl
+
+// Bytes count of `size` items of range `[first, last)` - items are walked only
+// if they have no fixed bytes count
+template <typename T, typename InputIt>
+inline std::size_t items_bytes_count(InputIt first, InputIt last, std::size_t size)
+{
+    return impl::items_bytes_count<T>(first, last, size, std::integral_constant<bool, fixed_bytes_count_trait<T>::is_fixed>{});
+}
+
+// -----------------------------------------------------------------------------
+
 template <typename ... Types>
 struct byte_count_params
 {
@@ -3,6 +3,7 @@
 
 #include "rt/serialization/rt_serialization_bytes_count.hpp"
 
+#include "ct/utils/ct_utils_accumulate.hpp"
 #include "ct/utils/ct_utils_index_sequence.hpp"
 
 #include "rt/serialization/rt_serialization_stl_collection_size.hpp"
@@ -18,9 +19,17 @@
 #include <list>
 
 // ---------------------------------------------------------
+// Associative containers
 
-// TODO: add associative containers
+#include <map>
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
 
+// ---------------------------------------------------------
+
+#include <iterator> // for std::distance()
+#include <string>
 #include <tuple>
 
 namespace rt {
@@ -32,101 +41,198 @@ template <typename T, std::size_t SIZE>
 struct bytes_count_trait< std::array<T, SIZE> >
 {
     using value_t = std::array<T, SIZE>;
+    using size_type = stl::collection_size_type<value_t>;
 
     static std::size_t bytes_count(const value_t& array)
     {
         std::size_t count = 0;
 
-        count += sizeof(stl::collection_size_t); // Size
-
-        for(const T& item : array) {
-            count += bytes_count_trait<T>::bytes_count(item);
-        }
+        count += sizeof(size_type); // Size
+        count += items_bytes_count<T>(array.begin(), array.end(), array.size());
 
         return count;
     }
 };
 
 // Specialization for std::vector
-template <typename T>
-struct bytes_count_trait< std::vector<T> >
+template <typename T, typename Allocator>
+struct bytes_count_trait< std::vector<T, Allocator> >
 {
-    using value_t = std::vector<T>;
+    using value_t = std::vector<T, Allocator>;
+    using size_type = stl::collection_size_type<value_t>;
 
     static std::size_t bytes_count(const value_t& vector)
     {
         std::size_t count = 0;
 
-        count += sizeof(stl::collection_size_t); // Size
-
-        for(const T& item : vector) {
-            count += bytes_count_trait<T>::bytes_count(item);
-        }
+        count += sizeof(size_type); // Size
+        count += items_bytes_count<T>(vector.begin(), vector.end(), vector.size());
 
         return count;
     }
 };
 
 // Specialization for std::deque
-template <typename T>
-struct bytes_count_trait< std::deque<T> >
+template <typename T, typename Allocator>
+struct bytes_count_trait< std::deque<T, Allocator> >
 {
-    using value_t = std::deque<T>;
+    using value_t = std::deque<T, Allocator>;
+    using size_type = stl::collection_size_type<value_t>;
 
     static std::size_t bytes_count(const value_t& deque)
     {
         std::size_t count = 0;
 
-        count += sizeof(stl::collection_size_t); // Size
-
-        for(const T& item : deque) {
-            count += bytes_count_trait<T>::bytes_count(item);
-        }
+        count += sizeof(size_type); // Size
+        count += items_bytes_count<T>(deque.begin(), deque.end(), deque.size());
 
         return count;
     }
 };
 
 // Specialization for std::forward_list
-template <typename T>
-struct bytes_count_trait< std::forward_list<T> >
+template <typename T, typename Allocator>
+struct bytes_count_trait< std::forward_list<T, Allocator> >
 {
-    using value_t = std::forward_list<T>;
+    using value_t = std::forward_list<T, Allocator>;
+    using size_type = stl::collection_size_type<value_t>;
 
     static std::size_t bytes_count(const value_t& list)
     {
         std::size_t count = 0;
 
-        count += sizeof(stl::collection_size_t); // Size
+        count += sizeof(size_type); // Size
 
-        for(const T& item : list) {
-            count += bytes_count_trait<T>::bytes_count(item);
-        }
+        // No `.size()` method - items are counted only if it is needed
+        const std::size_t list_size = fixed_bytes_count_trait<T>::is_fixed ? std::distance(list.begin(), list.end()) : 0;
+        count += items_bytes_count<T>(list.begin(), list.end(), list_size);
 
         return count;
     }
 };
 
 // Specialization for std::list
-template <typename T>
-struct bytes_count_trait< std::list<T> >
+template <typename T, typename Allocator>
+struct bytes_count_trait< std::list<T, Allocator> >
 {
-    using value_t = std::list<T>;
+    using value_t = std::list<T, Allocator>;
+    using size_type = stl::collection_size_type<value_t>;
 
     static std::size_t bytes_count(const value_t& list)
     {
         std::size_t count = 0;
 
-        count += sizeof(stl::collection_size_t); // Size
+        count += sizeof(size_type); // Size
+        count += items_bytes_count<T>(list.begin(), list.end(), list.size());
+
+        return count;
+    }
+};
+
+// Specialization for std::basic_string
+template <typename CharT, typename Traits, typename Allocator>
+struct bytes_count_trait< std::basic_string<CharT, Traits, Allocator> >
+{
+    using value_t = std::basic_string<CharT, Traits, Allocator>;
+    using size_type = stl::collection_size_type<value_t>;
+
+    static std::size_t bytes_count(const value_t& str) {
+        return sizeof(size_type) + (sizeof(CharT) * str.size());
+    }
+};
+
+// -----------------------------------------------------------------------------
+// Associative containers: size, then items in order of iteration (key & mapped
+// value for maps)
+
+namespace impl {
+
+template <typename Set>
+struct set_bytes_count
+{
+    using key_t = typename Set::key_type;
+    using size_type = stl::collection_size_type<Set>;
+
+    static std::size_t bytes_count(const Set& set)
+    {
+        std::size_t count = 0;
+
+        count += sizeof(size_type); // Size
+        count += serialization::items_bytes_count<key_t>(set.begin(), set.end(), set.size());
 
-        for(const T& item : list) {
-            count += bytes_count_trait<T>::bytes_count(item);
+        return count;
+    }
+};
+
+template <typename Map>
+struct map_bytes_count
+{
+    using key_t = typename Map::key_type;
+    using size_type = stl::collection_size_type<Map>;
+    using mapped_t = typename Map::mapped_type;
+
+    static constexpr bool is_fixed = fixed_bytes_count_trait<key_t>::is_fixed && fixed_bytes_count_trait<mapped_t>::is_fixed;
+
+    static std::size_t bytes_count(const Map& map)
+    {
+        std::size_t count = 0;
+
+        count += sizeof(size_type); // Size
+
+        if(is_fixed) {
+            return count + map.size() * (fixed_bytes_count_trait<key_t>::bytes_count + fixed_bytes_count_trait<mapped_t>::bytes_count);
+        }
+
+        for(const auto& item : map) {
+            count += bytes_count_trait<key_t>::bytes_count(item.first) + bytes_count_trait<mapped_t>::bytes_count(item.second);
         }
 
         return count;
     }
 };
 
+} // namespace impl
+
+template <typename Key, typename Compare, typename Allocator>
+struct bytes_count_trait< std::set<Key, Compare, Allocator> >
+        : impl::set_bytes_count< std::set<Key, Compare, Allocator> >
+{};
+
+template <typename Key, typename Compare, typename Allocator>
+struct bytes_count_trait< std::multiset<Key, Compare, Allocator> >
+        : impl::set_bytes_count< std::multiset<Key, Compare, Allocator> >
+{};
+
+template <typename Key, typename Hash, typename KeyEqual, typename Allocator>
+struct bytes_count_trait< std::unordered_set<Key, Hash, KeyEqual, Allocator> >
+        : impl::set_bytes_count< std::unordered_set<Key, Hash, KeyEqual, Allocator> >
+{};
+
+template <typename Key, typename Hash, typename KeyEqual, typename Allocator>
+struct bytes_count_trait< std::unordered_multiset<Key, Hash, KeyEqual, Allocator> >
+        : impl::set_bytes_count< std::unordered_multiset<Key, Hash, KeyEqual, Allocator> >
+{};
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+struct bytes_count_trait< std::map<Key, T, Compare, Allocator> >
+        : impl::map_bytes_count< std::map<Key, T, Compare, Allocator> >
+{};
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+struct bytes_count_trait< std::multimap<Key, T, Compare, Allocator> >
+        : impl::map_bytes_count< std::multimap<Key, T, Compare, Allocator> >
+{};
+
+template <typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+struct bytes_count_trait< std::unordered_map<Key, T, Hash, KeyEqual, Allocator> >
+        : impl::map_bytes_count< std::unordered_map<Key, T, Hash, KeyEqual, Allocator> >
+{};
+
+template <typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+struct bytes_count_trait< std::unordered_multimap<Key, T, Hash, KeyEqual, Allocator> >
+        : impl::map_bytes_count< std::unordered_multimap<Key, T, Hash, KeyEqual, Allocator> >
+{};
+
 // -----------------------------------------------------------------------------
 
 // Specialization for std::pair
@@ -161,21 +267,48 @@ struct bytes_count_trait< std::tuple<Types...> >
 
 // -----------------------------------------------------------------------------
 
+// -----------------------------------------------------------------------------
+// Fixed bytes counts
+
+template <typename T, std::size_t SIZE>
+struct fixed_bytes_count_trait< std::array<T, SIZE> >
+{
+    static constexpr bool is_fixed = fixed_bytes_count_trait<T>::is_fixed;
+    static constexpr std::size_t bytes_count = is_fixed ? (sizeof(stl::collection_size_type< std::array<T, SIZE> >) + (SIZE * fixed_bytes_count_trait<T>::bytes_count)) : 0;
+};
+
+template <typename First, typename Second>
+struct fixed_bytes_count_trait< std::pair<First, Second> >
+{
+    static constexpr bool is_fixed = fixed_bytes_count_trait<First>::is_fixed && fixed_bytes_count_trait<Second>::is_fixed;
+    static constexpr std::size_t bytes_count = is_fixed ? (fixed_bytes_count_trait<First>::bytes_count + fixed_bytes_count_trait<Second>::bytes_count) : 0;
+};
+
+template <typename ... Types>
+struct fixed_bytes_count_trait< std::tuple<Types...> >
+{
+    // No types of variable size (leading 0 - for empty tuple)
+    static constexpr bool is_fixed
+        = (ct::utils::accumulate( { std::size_t{0}, std::size_t{ fixed_bytes_count_trait<Types>::is_fixed ? 0U : 1U } ...}, std::size_t{0}) == 0);
+    static constexpr std::size_t bytes_count
+        = is_fixed ? ct::utils::accumulate( { std::size_t{0}, fixed_bytes_count_trait<Types>::bytes_count ...}, std::size_t{0}) : 0;
+};
+
+// -----------------------------------------------------------------------------
+
 // Specialization for std::initializer_list
 template <typename T>
 struct bytes_count_trait< std::initializer_list<T> >
 {
     using value_t = std::initializer_list<T>;
+    using size_type = stl::collection_size_type<value_t>;
 
     static std::size_t bytes_count(const value_t& list)
     {
         std::size_t count = 0;
 
-        count += sizeof(stl::collection_size_t); // Size
-
-        for(const T& item : list) {
-            count += bytes_count_trait<T>::bytes_count(item);
-        }
+        count += sizeof(size_type); // Size
+        count += items_bytes_count<T>(list.begin(), list.end(), list.size());
 
         return count;
     }
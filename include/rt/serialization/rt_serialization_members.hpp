@@ -0,0 +1,383 @@
+#ifndef RT__SERIALIZATION__MEMBERS_HPP
+#define RT__SERIALIZATION__MEMBERS_HPP
+
+#include "rt/serialization/rt_serialization_bytes_count.hpp"
+#include "rt/serialization/rt_serialization_pack.hpp"
+#include "rt/serialization/rt_serialization_unpack.hpp"
+
+#include "ct/utils/ct_utils_accumulate.hpp"
+#include "ct/utils/typelist/ct_utils_typelist.hpp"
+
+#include <cstring> // for std::memcpy()
+#include <type_traits>
+
+namespace rt {
+
+namespace serialization {
+
+/**
+    Registration of user structs by list of their members - instead of three
+    hand-written specializations (`pack_trait`, `unpack_trait` and
+    `bytes_count_trait`) for each struct. Members are packed in order of
+    registration.
+
+    @code{.cpp}
+    struct person
+    {
+        std::int32_t id;
+        float weight;
+        std::vector<std::int16_t> scores;
+    };
+
+    namespace rt {
+    namespace serialization {
+
+    template <>
+    struct members_trait<person>
+            : members<
+                RT_SERIALIZATION_MEMBER(&person::id),
+                RT_SERIALIZATION_MEMBER(&person::weight),
+                RT_SERIALIZATION_MEMBER(&person::scores)
+            >
+    {};
+
+    } // namespace serialization
+    } // namespace rt
+
+    rt::serialization::pack(bytes.data(), person{ ... });
+    @endcode
+
+    Runs of adjacent scalar members (like `id` & `weight` above) are copied by
+    single `std::memcpy()`, if there is no padding between them in memory and
+    byte order is native. Their bytes count is compile-time constant (as well
+    as of other members of fixed size, see `fixed_bytes_count_trait<T>`):
+    `bytes_count_trait<T>::fixed_bytes_count`, so only members of variable
+    size are counted in run-time. Structs with members of fixed size only are
+    of fixed size too.
+*/
+template <typename T>
+struct members_trait {};
+
+// Single registered member: `member< decltype(&T::field), &T::field >`
+template <typename MemberPtr, MemberPtr PTR>
+struct member;
+
+template <typename Class, typename T, T Class::* PTR>
+struct member<T Class::*, PTR>
+{
+    using class_t = Class;
+    using value_t = T;
+
+    static const value_t& get(const class_t& object) {
+        return object.*PTR;
+    }
+
+    static value_t& get(class_t& object) {
+        return object.*PTR;
+    }
+};
+
+#define RT_SERIALIZATION_MEMBER(PTR) ::rt::serialization::member< decltype(PTR), PTR >
+
+namespace impl {
+
+// Adjacent scalar members - may be copied by single std::memcpy()
+template <typename ... Members>
+struct scalar_run {};
+
+// Any other member - packed by its own traits
+template <typename Member>
+struct single_member {};
+
+/*
+    Splits members into groups:
+
+    < i32, f32, vector<i16>, i16, i16 > <-- Members
+    ---------------------------------------------------------------------------
+    < scalar_run<i32, f32>, single_member<vector<i16>>, scalar_run<i16, i16> >
+*/
+template <typename Done, typename Run, typename Rest>
+struct group_members;
+
+template <typename ... Done, typename Run>
+struct group_members< ct::utils::List<Done...>, Run, ct::utils::List<> >
+{
+    using type = ct::utils::List<Done..., Run>;
+};
+
+template <typename ... Done, typename ... Run, typename First, typename ... Rest>
+struct group_members< ct::utils::List<Done...>, scalar_run<Run...>, ct::utils::List<First, Rest...> >
+        : std::conditional< std::is_scalar<typename First::value_t>::value,
+            group_members< ct::utils::List<Done...>, scalar_run<Run..., First>, ct::utils::List<Rest...> >,
+            group_members< ct::utils::List<Done..., scalar_run<Run...>, single_member<First>>, scalar_run<>, ct::utils::List<Rest...> >
+          >::type
+{};
+
+// -----------------------------------------------------------------------------
+
+template <typename Group>
+struct group_trait;
+
+template <typename Member>
+struct group_trait< single_member<Member> >
+{
+    using class_t = typename Member::class_t;
+    using value_t = typename Member::value_t;
+
+    static constexpr bool is_fixed = fixed_bytes_count_trait<value_t>::is_fixed;
+    static constexpr std::size_t fixed_bytes_count = fixed_bytes_count_trait<value_t>::bytes_count;
+
+    static std::size_t variable_bytes_count(const class_t& object) {
+        return is_fixed ? 0 : bytes_count_trait<value_t>::bytes_count( Member::get(object) );
+    }
+
+    template <typename Policy>
+    static std::size_t pack(std::int8_t* dest, std::size_t offset, const class_t& object) {
+        return pack_value<Policy, value_t>(dest, offset, Member::get(object));
+    }
+
+    template <typename Policy>
+    static std::size_t unpack(const std::int8_t* src, std::size_t offset, class_t& object) {
+        return unpack_value<Policy, value_t>(src, offset, Member::get(object));
+    }
+
+    template <typename Policy, typename Output>
+    static void write(Output& out, const class_t& object) {
+        value_writer<value_t, Policy>::write(out, Member::get(object));
+    }
+};
+
+template <>
+struct group_trait< scalar_run<> >
+{
+    static constexpr bool is_fixed = true;
+    static constexpr std::size_t fixed_bytes_count = 0;
+
+    template <typename Class>
+    static constexpr std::size_t variable_bytes_count(const Class& ) {
+        return 0;
+    }
+
+    template <typename Policy, typename Class>
+    static std::size_t pack(std::int8_t* , std::size_t offset, const Class& ) {
+        return offset;
+    }
+
+    template <typename Policy, typename Class>
+    static std::size_t unpack(const std::int8_t* , std::size_t offset, Class& ) {
+        return offset;
+    }
+
+    template <typename Policy, typename Output, typename Class>
+    static void write(Output& , const Class& )
+    {}
+};
+
+template <typename First, typename ... Members>
+struct group_trait< scalar_run<First, Members...> >
+{
+    using class_t = typename First::class_t;
+
+    static constexpr bool is_fixed = true;
+    static constexpr std::size_t fixed_bytes_count
+        = ct::utils::accumulate( { sizeof(typename First::value_t), sizeof(typename Members::value_t) ...}, std::size_t{0});
+
+    static constexpr std::size_t variable_bytes_count(const class_t& ) {
+        return 0;
+    }
+
+    // Members are placed one after another, without padding (and in the same
+    // order). Offsets of members are constants, so that check is folded by
+    // compiler
+    static bool is_contiguous(const class_t& object)
+    {
+        const char* addresses[] = { reinterpret_cast<const char*>( &First::get(object) ), reinterpret_cast<const char*>( &Members::get(object) ) ... };
+        const std::size_t sizes[] = { sizeof(typename First::value_t), sizeof(typename Members::value_t) ... };
+
+        for(std::size_t i = 1; i < (1 + sizeof...(Members)); ++i) {
+            if(addresses[i] != (addresses[i - 1] + sizes[i - 1])) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    // Members are copied as is - in native byte order, without varints
+    template <typename Policy>
+    static bool is_copyable(const class_t& object) {
+        return ct::utils::byte_order_utils<Policy::order>::is_native && (Policy::encoding == integer_encoding::fixed) && is_contiguous(object);
+    }
+
+    template <typename Policy>
+    static std::size_t pack(std::int8_t* dest, std::size_t offset, const class_t& object)
+    {
+        if(is_copyable<Policy>(object)) {
+            std::memcpy( (dest + offset), &First::get(object), fixed_bytes_count );
+            return offset + fixed_bytes_count;
+        }
+
+        return param_packer< typename First::value_t, typename Members::value_t ... >::template pack<Policy>(dest, offset, First::get(object), Members::get(object) ...);
+    }
+
+    template <typename Policy>
+    static std::size_t unpack(const std::int8_t* src, std::size_t offset, class_t& object)
+    {
+        if(is_copyable<Policy>(object)) {
+            std::memcpy( &First::get(object), (src + offset), fixed_bytes_count );
+            return offset + fixed_bytes_count;
+        }
+
+        return param_unpacker< typename First::value_t, typename Members::value_t ... >::template unpack<Policy>(src, offset, First::get(object), Members::get(object) ...);
+    }
+
+    template <typename Policy, typename Output>
+    static void write(Output& out, const class_t& object)
+    {
+        constexpr std::size_t MAX_BYTES_COUNT = impl::max_packed_bytes_count<Policy>(fixed_bytes_count);
+        out.shrink( MAX_BYTES_COUNT - pack<Policy>(out.append(MAX_BYTES_COUNT), 0, object) );
+    }
+};
+
+// -----------------------------------------------------------------------------
+
+template <typename Groups>
+struct groups_trait;
+
+template <typename ... Groups>
+struct groups_trait< ct::utils::List<Groups...> >
+{
+    // All members have fixed bytes count
+    static constexpr bool is_fixed
+        = (ct::utils::accumulate( { std::size_t{ group_trait<Groups>::is_fixed ? 0U : 1U } ...}, std::size_t{0}) == 0);
+
+    static constexpr std::size_t fixed_bytes_count
+        = ct::utils::accumulate( { group_trait<Groups>::fixed_bytes_count ...}, std::size_t{0});
+
+    template <typename Class>
+    static std::size_t bytes_count(const Class& object)
+    {
+        std::size_t count = fixed_bytes_count;
+
+        using dummy_t = std::size_t[];
+        (void) dummy_t {
+            count += group_trait<Groups>::variable_bytes_count(object) ...
+        };
+
+        return count;
+    }
+
+    template <typename Policy, typename Class>
+    static std::size_t pack(std::int8_t* dest, std::size_t offset, const Class& object)
+    {
+        using dummy_t = std::size_t[];
+        (void) dummy_t {
+            (offset = group_trait<Groups>::template pack<Policy>(dest, offset, object)) ...
+        };
+
+        return offset;
+    }
+
+    template <typename Policy, typename Class>
+    static std::size_t unpack(const std::int8_t* src, std::size_t offset, Class& object)
+    {
+        using dummy_t = std::size_t[];
+        (void) dummy_t {
+            (offset = group_trait<Groups>::template unpack<Policy>(src, offset, object)) ...
+        };
+
+        return offset;
+    }
+
+    template <typename Policy, typename Output, typename Class>
+    static void write(Output& out, const Class& object)
+    {
+        using dummy_t = int[];
+        (void) dummy_t {
+            (group_trait<Groups>::template write<Policy>(out, object), 0) ...
+        };
+    }
+};
+
+} // namespace impl
+
+// List of registered members (base of `members_trait<T>` specializations)
+template <typename ... Members>
+struct members
+{
+    static_assert(sizeof...(Members) > 0, "At least one member must be registered");
+
+    using members_t = members<Members...>;
+    using groups_t = typename impl::group_members< ct::utils::List<>, impl::scalar_run<>, ct::utils::List<Members...> >::type;
+};
+
+// Is `T` registered by `members_trait<T>`
+template <typename T, typename Enabled = void>
+struct has_members
+        : std::false_type
+{};
+
+template <typename T>
+struct has_members< T, typename impl::void_type< typename members_trait<T>::members_t >::type >
+        : std::true_type
+{};
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+struct bytes_count_trait< T, typename std::enable_if< has_members<T>::value == true >::type >
+{
+    using value_t = T;
+    using groups_trait_t = impl::groups_trait< typename members_trait<T>::groups_t >;
+
+    // Bytes count of all members of fixed size (see fixed_bytes_count_trait<T>)
+    static constexpr std::size_t fixed_bytes_count = groups_trait_t::fixed_bytes_count;
+
+    static std::size_t bytes_count(const value_t& value) {
+        return groups_trait_t::bytes_count(value);
+    }
+};
+
+template <typename T>
+struct fixed_bytes_count_trait< T, typename std::enable_if< has_members<T>::value == true >::type >
+{
+    using groups_trait_t = impl::groups_trait< typename members_trait<T>::groups_t >;
+
+    static constexpr bool is_fixed = groups_trait_t::is_fixed;
+    static constexpr std::size_t bytes_count = is_fixed ? groups_trait_t::fixed_bytes_count : 0;
+};
+
+template <typename T>
+struct pack_trait< T, typename std::enable_if< has_members<T>::value == true >::type >
+{
+    using value_t = T;
+    using groups_trait_t = impl::groups_trait< typename members_trait<T>::groups_t >;
+
+    template <typename Policy = default_policy>
+    static std::size_t pack(std::int8_t* dest, std::size_t offset, const value_t& value) {
+        return groups_trait_t::template pack<Policy>(dest, offset, value);
+    }
+
+    template <typename Policy = default_policy, typename Output>
+    static void write(Output& out, const value_t& value) {
+        groups_trait_t::template write<Policy>(out, value);
+    }
+};
+
+template <typename T>
+struct unpack_trait< T, typename std::enable_if< has_members<T>::value == true >::type >
+{
+    using value_t = T;
+    using groups_trait_t = impl::groups_trait< typename members_trait<T>::groups_t >;
+
+    template <typename Policy = default_policy>
+    static std::size_t unpack(const std::int8_t* src, std::size_t offset, value_t& value) {
+        return groups_trait_t::template unpack<Policy>(src, offset, value);
+    }
+};
+
+} // namespace serialization
+
+} // namespace rt
+
+#endif // RT__SERIALIZATION__MEMBERS_HPP
@@ -1,10 +1,16 @@
 #ifndef RT__SERIALIZATION__PACK_HPP
 #define RT__SERIALIZATION__PACK_HPP
 
+#include "rt/serialization/rt_serialization_policy.hpp"
+#include "rt/serialization/rt_serialization_bytes_count.hpp"
+#include "rt/serialization/rt_serialization_varint.hpp"
+#include "rt/serialization/rt_serialization_writer.hpp"
+
 #include <type_traits> // for std::enable_if<T>::type, std::is_trivially_copyable<T>::value
 
 #include <cstdint> // for std::int8_t
 #include <cstring> // for std::memcpy()
+#include <utility> // for std::declval<T>()
 
 namespace rt {
 
@@ -20,26 +26,191 @@ struct pack_trait<T, typename std::enable_if< std::is_scalar<T>::value == true >
 {
     using value_t = T;
 
-    static std::size_t pack(std::int8_t* dest, std::size_t offset, const value_t& value)
+    template <typename Policy = default_policy>
+    static std::size_t pack(std::int8_t* dest, std::size_t offset, const value_t& value) {
+        return offset + impl::store_items<Policy>( (dest + offset), &value, 1 );
+    }
+};
+
+namespace impl {
+
+// Has `pack_trait<T>` template `pack<Policy>()` (custom traits, written
+// without policy support, have plain `pack()`)
+template <typename T, typename Policy, typename Enabled = void>
+struct has_policy_pack
+        : std::false_type
+{};
+
+template <typename T, typename Policy>
+struct has_policy_pack< T, Policy, typename void_type< decltype( pack_trait<T>::template pack<Policy>(std::declval<std::int8_t*>(), std::size_t{}, std::declval<const T&>()) ) >::type >
+        : std::true_type
+{};
+
+template <typename Policy, typename T>
+inline std::size_t pack_value_impl(std::int8_t* dest, std::size_t offset, const T& value, std::true_type /* has_policy_pack */) {
+    return pack_trait<T>::template pack<Policy>(dest, offset, value);
+}
+
+template <typename Policy, typename T>
+inline std::size_t pack_value_impl(std::int8_t* dest, std::size_t offset, const T& value, std::false_type /* has_policy_pack */)
+{
+    static_assert(is_plain_policy<Policy>::value, "rt::serialization: pack_trait<T> without template pack<Policy>() supports only native byte order & fixed encoding");
+    return pack_trait<T>::pack(dest, offset, value);
+}
+
+} // namespace impl
+
+// Packing of single value by `pack_trait<T>` - with `Policy`, or by plain
+// `pack()` of custom trait without policy support
+template <typename Policy, typename T>
+inline std::size_t pack_value(std::int8_t* dest, std::size_t offset, const T& value) {
+    return impl::pack_value_impl<Policy>(dest, offset, value, impl::has_policy_pack<T, Policy>{});
+}
+
+namespace impl {
+
+// Has `pack_trait<T>` own `write<Policy>(Output&, const T&)`
+template <typename T, typename Policy, typename Output, typename Enabled = void>
+struct has_write
+        : std::false_type
+{};
+
+template <typename T, typename Policy, typename Output>
+struct has_write< T, Policy, Output, typename void_type< decltype( pack_trait<T>::template write<Policy>(std::declval<Output&>(), std::declval<const T&>()) ) >::type >
+        : std::true_type
+{};
+
+} // namespace impl
+
+/**
+    Packing of single value into output (single pass) - `writer`, or any other
+    type with the same `append(count)`, `shrink(count)`, `append_items<T,
+    Policy>(items, count)` and `batch_bytes_count()` functions (see
+    `rope_writer`):
+
+    - if `pack_trait<T>` has own `write<Policy>(Output&, const T&)` - it is
+      used (containers of items of variable size write items one by one);
+    - otherwise `bytes_count_trait<T>::bytes_count(value)` bytes are appended
+      and value is packed into them by `pack_value<Policy>()`. That is cheap
+      for values of fixed size, or containers of such items (see
+      `fixed_bytes_count_trait<T>`) - so custom traits work without changes.
+      With varint encoding upper bound of bytes count is appended, and unused
+      bytes are returned back by `shrink()`.
+*/
+template <typename T, typename Policy = default_policy>
+struct value_writer
+{
+    template <typename Output>
+    static void write(Output& out, const T& value) {
+        write_impl(out, value, impl::has_write<T, Policy, Output>{});
+    }
+
+private:
+    template <typename Output>
+    static void write_impl(Output& out, const T& value, std::true_type /* has_write */) {
+        pack_trait<T>::template write<Policy>(out, value);
+    }
+
+    template <typename Output>
+    static void write_impl(Output& out, const T& value, std::false_type /* has_write */)
     {
-        constexpr std::size_t BYTES_COUNT = sizeof(value_t);
-        std::memcpy( (dest + offset), &value, BYTES_COUNT );
-        return offset + BYTES_COUNT;
+        const std::size_t max_count = impl::max_packed_bytes_count<Policy>( bytes_count_trait<T>::bytes_count(value) );
+
+        std::int8_t* dest = out.append(max_count);
+        out.shrink( max_count - pack_value<Policy, T>(dest, 0, value) );
     }
 };
 
+// Packing of items of range `[first, last)` (which contains `size` items)
+// into output: items of fixed size - into appended bytes (by batches of up to
+// `out.batch_bytes_count()`, so segmented outputs don't need single segment for
+// whole container), otherwise - one by one
+template <typename Policy, typename T, typename Output, typename InputIt>
+inline void write_items(Output& out, InputIt first, InputIt last, std::size_t size)
+{
+    if(fixed_bytes_count_trait<T>::is_fixed)
+    {
+        constexpr std::size_t ITEM_BYTES_COUNT = impl::max_packed_bytes_count<Policy>( fixed_bytes_count_trait<T>::bytes_count );
+        const std::size_t batch_bytes_count = out.batch_bytes_count();
+        const std::size_t batch_size = ((ITEM_BYTES_COUNT > 0) && (ITEM_BYTES_COUNT < batch_bytes_count))
+                ? (batch_bytes_count / ITEM_BYTES_COUNT)
+                : 1;
+
+        while(size > 0)
+        {
+            const std::size_t count = (size < batch_size) ? size : batch_size;
+            std::int8_t* dest = out.append(count * ITEM_BYTES_COUNT);
+
+            std::size_t offset = 0;
+            for(std::size_t i = 0; i < count; ++i, ++first) {
+                offset = pack_value<Policy, T>(dest, offset, *first);
+            }
+            out.shrink( (count * ITEM_BYTES_COUNT) - offset ); // Varint encoding
+
+            size -= count;
+        }
+        return;
+    }
+
+    for(; first != last; ++first) {
+        value_writer<T, Policy>::write(out, *first);
+    }
+}
+
+// Packing of `count` scalar items into output: by `out.append_items()` (so
+// items may be split between segments), varints - by batches
+template <typename Policy, typename T, typename Output>
+inline void write_scalar_items(Output& out, const T* items, std::size_t count, std::false_type /* is_varint */) {
+    out.template append_items<T, Policy>(items, count);
+}
+
+template <typename Policy, typename T, typename Output>
+inline void write_scalar_items(Output& out, const T* items, std::size_t count, std::true_type /* is_varint */)
+{
+    constexpr std::size_t ITEM_BYTES_COUNT = varint::max_bytes_count<T>();
+    const std::size_t batch_size = (ITEM_BYTES_COUNT < out.batch_bytes_count()) ? (out.batch_bytes_count() / ITEM_BYTES_COUNT) : 1;
+
+    while(count > 0)
+    {
+        const std::size_t batch_count = (count < batch_size) ? count : batch_size;
+
+        std::int8_t* dest = out.append(batch_count * ITEM_BYTES_COUNT);
+        out.shrink( (batch_count * ITEM_BYTES_COUNT) - varint::encode_items(dest, items, batch_count) );
+
+        items += batch_count;
+        count -= batch_count;
+    }
+}
+
+template <typename Policy, typename T, typename Output>
+inline void write_scalar_items(Output& out, const T* items, std::size_t count) {
+    write_scalar_items<Policy>(out, items, count, impl::is_varint<T, Policy>{});
+}
+
+// -----------------------------------------------------------------------------
+
 template <typename ... Types>
 struct param_packer
 {
+    template <typename Policy = default_policy>
     static std::size_t pack(std::int8_t* dest, std::size_t offset, const Types& ... values)
     {
         using dummy_t = std::size_t[];
         (void) dummy_t {
-            (offset = pack_trait<Types>::pack(dest, offset, values), /* for debug: */ offset) ...
+            (offset = pack_value<Policy, Types>(dest, offset, values), /* for debug: */ offset) ...
         };
 
         return offset;
     }
+
+    template <typename Policy = default_policy, typename Output>
+    static void write(Output& out, const Types& ... values)
+    {
+        using dummy_t = int[];
+        (void) dummy_t {
+            (value_writer<Types, Policy>::write(out, values), 0) ...
+        };
+    }
 };
 
 // -----------------------------------------------------------------------------
@@ -51,6 +222,33 @@ inline std::size_t pack(std::int8_t* bytes, const Args& ... args)
     return param_packer<Args...>::pack(bytes, 0, args...);
 }
 
+// The same, but with explicitly specified policy (for example - byte order)
+template <typename Policy, typename ... Args>
+inline std::size_t pack_with(std::int8_t* bytes, const Args& ... args)
+{
+    return param_packer<Args...>::template pack<Policy>(bytes, 0, args...);
+}
+
+// Bytes count, which is enough for packing with `Policy`: `bytes_count()` for
+// fixed encoding, its upper bound for varints
+template <typename Policy, typename ... Args>
+inline std::size_t max_bytes_count_with(const Args& ... args) {
+    return impl::max_packed_bytes_count<Policy>( bytes_count(args...) );
+}
+
+// Single-pass packing into growable buffer (without `bytes_count()`)
+template <typename ... Args>
+inline void pack(writer& out, const Args& ... args)
+{
+    param_packer<Args...>::write(out, args...);
+}
+
+template <typename Policy, typename ... Args>
+inline void pack_with(writer& out, const Args& ... args)
+{
+    param_packer<Args...>::template write<Policy>(out, args...);
+}
+
 // -----------------------------------------------------------------------------
 
 } // namespace serialization
@@ -2,12 +2,14 @@
 #define RT__SERIALIZATION__PACK__STL_HPP
 
 #include "rt/serialization/rt_serialization_pack.hpp"
+#include "rt/serialization/rt_serialization_bytes_count_stl.hpp"
 
 #include "ct/utils/ct_utils_index_sequence.hpp"
 
 #include "rt/serialization/rt_serialization_stl_collection_size.hpp"
 
 #include <array>
+#include <string>
 #include <vector>
 #include <tuple>
 
@@ -15,6 +17,11 @@
 #include <forward_list>
 #include <list>
 
+#include <map>
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
+
 namespace rt {
     
 namespace serialization {
@@ -26,16 +33,15 @@ template <typename T, std::size_t SIZE>
 struct pack_trait< std::array<T, SIZE>, typename std::enable_if< std::is_scalar<T>::value == true>::type >
 {
     using value_t = std::array<T, SIZE>;
+    using size_type = stl::collection_size_type<value_t>;
 
+    template <typename Policy = default_policy>
     static std::size_t pack(std::int8_t* dest, std::size_t offset, const value_t& array)
     {
         // Pack size (well, this is not needed, but for better strictness during unpacking)
-        offset = pack_trait<stl::collection_size_t>::pack(dest, offset, SIZE);
-
-        const std::size_t DATA_BYTES_COUNT = (sizeof(T) * SIZE);
-        std::memcpy( (dest + offset), array.data(), DATA_BYTES_COUNT);
+        offset = pack_value<Policy, size_type>(dest, offset, stl::to_collection_size<value_t>(SIZE));
 
-        return offset += DATA_BYTES_COUNT;
+        return offset + impl::store_items<Policy>( (dest + offset), array.data(), SIZE );
     }
 };
 
@@ -44,57 +50,85 @@ template <typename T, std::size_t SIZE>
 struct pack_trait< std::array<T, SIZE>, typename std::enable_if< std::is_scalar<T>::value == false>::type >
 {
     using value_t = std::array<T, SIZE>;
+    using size_type = stl::collection_size_type<value_t>;
 
+    template <typename Policy = default_policy>
     static std::size_t pack(std::int8_t* dest, std::size_t offset, const value_t& array)
     {
         // Pack size (well, this is not needed, but for better strictness during unpacking)
-        offset = pack_trait<stl::collection_size_t>::pack(dest, offset, array.size());
+        offset = pack_value<Policy, size_type>(dest, offset, stl::to_collection_size<value_t>(array.size()));
 
         for(const T& item : array) {
-            offset = pack_trait<T>::pack(dest, offset, item);
+            offset = pack_value<Policy, T>(dest, offset, item);
         }
 
         return offset;
     }
+
+    // Single pass (see value_writer<T>)
+    template <typename Policy = default_policy, typename Output>
+    static void write(Output& out, const value_t& array)
+    {
+        value_writer<size_type, Policy>::write(out, stl::to_collection_size<value_t>(SIZE));
+        write_items<Policy, T>(out, array.begin(), array.end(), SIZE);
+    }
 };
 
 // -----------------------------------------------------------------------------
 
 // Specialization for std::vector (with scalar items)
-template <typename T>
-struct pack_trait< std::vector<T>, typename std::enable_if< std::is_scalar<T>::value == true>::type >
+template <typename T, typename Allocator>
+struct pack_trait< std::vector<T, Allocator>, typename std::enable_if< std::is_scalar<T>::value == true>::type >
 {
-    using value_t = std::vector<T>;
+    using value_t = std::vector<T, Allocator>;
+    using size_type = stl::collection_size_type<value_t>;
 
+    template <typename Policy = default_policy>
     static std::size_t pack(std::int8_t* dest, std::size_t offset, const value_t& vec)
     {
         // Pack size
-        offset = pack_trait<stl::collection_size_t>::pack(dest, offset, vec.size());
+        offset = pack_value<Policy, size_type>(dest, offset, stl::to_collection_size<value_t>(vec.size()));
 
-        const std::size_t DATA_BYTES_COUNT = (sizeof(T) * vec.size());
-        std::memcpy( (dest + offset), vec.data(), DATA_BYTES_COUNT);
+        return offset + impl::store_items<Policy>( (dest + offset), vec.data(), vec.size() );
+    }
 
-        return offset += DATA_BYTES_COUNT;
+    // Single pass (see value_writer<T>) - items may be split between segments
+    // of output (see rope_writer)
+    template <typename Policy = default_policy, typename Output>
+    static void write(Output& out, const value_t& vec)
+    {
+        value_writer<size_type, Policy>::write(out, stl::to_collection_size<value_t>(vec.size()));
+        write_scalar_items<Policy>(out, vec.data(), vec.size());
     }
 };
 
 // Specialization for std::vector (with non-scalar items)
-template <typename T>
-struct pack_trait< std::vector<T>, typename std::enable_if< std::is_scalar<T>::value == false>::type >
+template <typename T, typename Allocator>
+struct pack_trait< std::vector<T, Allocator>, typename std::enable_if< std::is_scalar<T>::value == false>::type >
 {
-    using value_t = std::vector<T>;
+    using value_t = std::vector<T, Allocator>;
+    using size_type = stl::collection_size_type<value_t>;
 
+    template <typename Policy = default_policy>
     static std::size_t pack(std::int8_t* dest, std::size_t offset, const value_t& vec)
     {
         // Pack size
-        offset = pack_trait<stl::collection_size_t>::pack(dest, offset, vec.size());
+        offset = pack_value<Policy, size_type>(dest, offset, stl::to_collection_size<value_t>(vec.size()));
 
         for(const T& item : vec) {
-            offset = pack_trait<T>::pack(dest, offset, item);
+            offset = pack_value<Policy, T>(dest, offset, item);
         }
 
         return offset;
     }
+
+    // Single pass (see value_writer<T>)
+    template <typename Policy = default_policy, typename Output>
+    static void write(Output& out, const value_t& vec)
+    {
+        value_writer<size_type, Policy>::write(out, stl::to_collection_size<value_t>(vec.size()));
+        write_items<Policy, T>(out, vec.begin(), vec.end(), vec.size());
+    }
 };
 
 // -----------------------------------------------------------------------------
@@ -105,12 +139,20 @@ struct pack_trait< std::pair<First, Second> >
 {
     using value_t = std::pair<First, Second>;
 
+    template <typename Policy = default_policy>
     static std::size_t pack(std::int8_t* dest, std::size_t offset, const value_t& pair)
     {
-        offset = pack_trait<First >::pack(dest, offset, pair.first);
-        offset = pack_trait<Second>::pack(dest, offset, pair.second);
+        offset = pack_value<Policy, First>(dest, offset, pair.first);
+        offset = pack_value<Policy, Second>(dest, offset, pair.second);
         return offset;
     }
+
+    template <typename Policy = default_policy, typename Output>
+    static void write(Output& out, const value_t& pair)
+    {
+        value_writer<First,  Policy>::write(out, pair.first);
+        value_writer<Second, Policy>::write(out, pair.second);
+    }
 };
 
 
@@ -120,45 +162,70 @@ struct pack_trait< std::tuple<Types...> >
 {
     using value_t = std::tuple<Types...>;
 
-    template <int ... Indexes>
+    template <typename Policy, int ... Indexes>
     static std::size_t pack_impl(std::int8_t* dest, std::size_t offset, const value_t& tuple, ct::ind_seq::index<Indexes...>)
     {
-        return param_packer<Types...>::pack(dest, offset, std::get<Indexes>(tuple)...); // Unpack tuple items
+        return param_packer<Types...>::template pack<Policy>(dest, offset, std::get<Indexes>(tuple)...); // Unpack tuple items
     }
 
+    template <typename Policy = default_policy>
     static std::size_t pack(std::int8_t* dest, std::size_t offset, const value_t& tuple)
     {
-        return pack_impl(dest, offset, tuple, ct::ind_seq::gen_seq<sizeof...(Types)>{});
+        return pack_impl<Policy>(dest, offset, tuple, ct::ind_seq::gen_seq<sizeof...(Types)>{});
+    }
+
+    template <typename Policy, typename Output, int ... Indexes>
+    static void write_impl(Output& out, const value_t& tuple, ct::ind_seq::index<Indexes...>)
+    {
+        param_packer<Types...>::template write<Policy>(out, std::get<Indexes>(tuple)...);
+    }
+
+    template <typename Policy = default_policy, typename Output>
+    static void write(Output& out, const value_t& tuple)
+    {
+        write_impl<Policy>(out, tuple, ct::ind_seq::gen_seq<sizeof...(Types)>{});
     }
 };
 
 // -----------------------------------------------------------------------------
 
 // Specialization for std::deque
-template <typename T>
-struct pack_trait< std::deque<T> >
+template <typename T, typename Allocator>
+struct pack_trait< std::deque<T, Allocator> >
 {
-    using value_t = std::deque<T>;
+    using value_t = std::deque<T, Allocator>;
+    using size_type = stl::collection_size_type<value_t>;
 
+    template <typename Policy = default_policy>
     static std::size_t pack(std::int8_t* dest, std::size_t offset, const value_t& deque)
     {
         // Pack size
-        offset = pack_trait<stl::collection_size_t>::pack(dest, offset, deque.size());
+        offset = pack_value<Policy, size_type>(dest, offset, stl::to_collection_size<value_t>(deque.size()));
 
         for(const T& item : deque) {
-            offset = pack_trait<T>::pack(dest, offset, item);
+            offset = pack_value<Policy, T>(dest, offset, item);
         }
 
         return offset;
     }
+
+    // Single pass (see value_writer<T>)
+    template <typename Policy = default_policy, typename Output>
+    static void write(Output& out, const value_t& deque)
+    {
+        value_writer<size_type, Policy>::write(out, stl::to_collection_size<value_t>(deque.size()));
+        write_items<Policy, T>(out, deque.begin(), deque.end(), deque.size());
+    }
 };
 
 // Specialization for std::forward_list
-template <typename T>
-struct pack_trait< std::forward_list<T> >
+template <typename T, typename Allocator>
+struct pack_trait< std::forward_list<T, Allocator> >
 {
-    using value_t = std::forward_list<T>;
+    using value_t = std::forward_list<T, Allocator>;
+    using size_type = stl::collection_size_type<value_t>;
 
+    template <typename Policy = default_policy>
     static std::size_t pack(std::int8_t* dest, std::size_t offset, const value_t& list)
     {
         // Note:: std::forward_list has no `.size()` method, that's why was used
@@ -170,35 +237,188 @@ struct pack_trait< std::forward_list<T> >
 
         // Pack size
         const std::size_t list_size = std::distance(list.begin(), list.end());
-        offset = pack_trait<stl::collection_size_t>::pack(dest, offset, list_size);
+        offset = pack_value<Policy, size_type>(dest, offset, stl::to_collection_size<value_t>(list_size));
 
         for(const T& item : list) {
-            offset = pack_trait<T>::pack(dest, offset, item);
+            offset = pack_value<Policy, T>(dest, offset, item);
         }
 
         return offset;
     }
+
+    // Single pass (see value_writer<T>)
+    template <typename Policy = default_policy, typename Output>
+    static void write(Output& out, const value_t& list)
+    {
+        const std::size_t list_size = std::distance(list.begin(), list.end());
+        value_writer<size_type, Policy>::write(out, stl::to_collection_size<value_t>(list_size));
+        write_items<Policy, T>(out, list.begin(), list.end(), list_size);
+    }
 };
 
 // Specialization for std::list
-template <typename T>
-struct pack_trait< std::list<T> >
+template <typename T, typename Allocator>
+struct pack_trait< std::list<T, Allocator> >
 {
-    using value_t = std::list<T>;
+    using value_t = std::list<T, Allocator>;
+    using size_type = stl::collection_size_type<value_t>;
 
+    template <typename Policy = default_policy>
     static std::size_t pack(std::int8_t* dest, std::size_t offset, const value_t& list)
     {
         // Pack size
-        offset = pack_trait<stl::collection_size_t>::pack(dest, offset, list.size());
+        offset = pack_value<Policy, size_type>(dest, offset, stl::to_collection_size<value_t>(list.size()));
 
         for(const T& item : list) {
-            offset = pack_trait<T>::pack(dest, offset, item);
+            offset = pack_value<Policy, T>(dest, offset, item);
+        }
+
+        return offset;
+    }
+
+    // Single pass (see value_writer<T>)
+    template <typename Policy = default_policy, typename Output>
+    static void write(Output& out, const value_t& list)
+    {
+        value_writer<size_type, Policy>::write(out, stl::to_collection_size<value_t>(list.size()));
+        write_items<Policy, T>(out, list.begin(), list.end(), list.size());
+    }
+};
+
+// Specialization for std::basic_string - characters are copied at once
+template <typename CharT, typename Traits, typename Allocator>
+struct pack_trait< std::basic_string<CharT, Traits, Allocator> >
+{
+    using value_t = std::basic_string<CharT, Traits, Allocator>;
+    using size_type = stl::collection_size_type<value_t>;
+
+    template <typename Policy = default_policy>
+    static std::size_t pack(std::int8_t* dest, std::size_t offset, const value_t& str)
+    {
+        // Pack size
+        offset = pack_value<Policy, size_type>(dest, offset, stl::to_collection_size<value_t>(str.size()));
+
+        return offset + impl::store_items<Policy>( (dest + offset), str.data(), str.size() );
+    }
+
+    // Single pass (see value_writer<T>)
+    template <typename Policy = default_policy, typename Output>
+    static void write(Output& out, const value_t& str)
+    {
+        value_writer<size_type, Policy>::write(out, stl::to_collection_size<value_t>(str.size()));
+        write_scalar_items<Policy>(out, str.data(), str.size());
+    }
+};
+
+// -----------------------------------------------------------------------------
+// Associative containers (see bytes_count_trait)
+
+namespace impl {
+
+template <typename Set>
+struct set_packer
+{
+    using key_t = typename Set::key_type;
+    using size_type = stl::collection_size_type<Set>;
+
+    template <typename Policy = default_policy>
+    static std::size_t pack(std::int8_t* dest, std::size_t offset, const Set& set)
+    {
+        // Pack size
+        offset = pack_value<Policy, size_type>(dest, offset, stl::to_collection_size<Set>(set.size()));
+
+        for(const key_t& item : set) {
+            offset = pack_value<Policy, key_t>(dest, offset, item);
         }
 
         return offset;
     }
+
+    // Single pass (see value_writer<T>)
+    template <typename Policy = default_policy, typename Output>
+    static void write(Output& out, const Set& set)
+    {
+        value_writer<size_type, Policy>::write(out, stl::to_collection_size<Set>(set.size()));
+        write_items<Policy, key_t>(out, set.begin(), set.end(), set.size());
+    }
 };
 
+template <typename Map>
+struct map_packer
+{
+    using key_t = typename Map::key_type;
+    using size_type = stl::collection_size_type<Map>;
+    using mapped_t = typename Map::mapped_type;
+
+    template <typename Policy = default_policy>
+    static std::size_t pack(std::int8_t* dest, std::size_t offset, const Map& map)
+    {
+        // Pack size
+        offset = pack_value<Policy, size_type>(dest, offset, stl::to_collection_size<Map>(map.size()));
+
+        for(const auto& item : map) {
+            offset = pack_value<Policy, key_t>(dest, offset, item.first);
+            offset = pack_value<Policy, mapped_t>(dest, offset, item.second);
+        }
+
+        return offset;
+    }
+
+    // Single pass (see value_writer<T>)
+    template <typename Policy = default_policy, typename Output>
+    static void write(Output& out, const Map& map)
+    {
+        value_writer<size_type, Policy>::write(out, stl::to_collection_size<Map>(map.size()));
+
+        for(const auto& item : map) {
+            value_writer<key_t,    Policy>::write(out, item.first);
+            value_writer<mapped_t, Policy>::write(out, item.second);
+        }
+    }
+};
+
+} // namespace impl
+
+template <typename Key, typename Compare, typename Allocator>
+struct pack_trait< std::set<Key, Compare, Allocator> >
+        : impl::set_packer< std::set<Key, Compare, Allocator> >
+{};
+
+template <typename Key, typename Compare, typename Allocator>
+struct pack_trait< std::multiset<Key, Compare, Allocator> >
+        : impl::set_packer< std::multiset<Key, Compare, Allocator> >
+{};
+
+template <typename Key, typename Hash, typename KeyEqual, typename Allocator>
+struct pack_trait< std::unordered_set<Key, Hash, KeyEqual, Allocator> >
+        : impl::set_packer< std::unordered_set<Key, Hash, KeyEqual, Allocator> >
+{};
+
+template <typename Key, typename Hash, typename KeyEqual, typename Allocator>
+struct pack_trait< std::unordered_multiset<Key, Hash, KeyEqual, Allocator> >
+        : impl::set_packer< std::unordered_multiset<Key, Hash, KeyEqual, Allocator> >
+{};
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+struct pack_trait< std::map<Key, T, Compare, Allocator> >
+        : impl::map_packer< std::map<Key, T, Compare, Allocator> >
+{};
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+struct pack_trait< std::multimap<Key, T, Compare, Allocator> >
+        : impl::map_packer< std::multimap<Key, T, Compare, Allocator> >
+{};
+
+template <typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+struct pack_trait< std::unordered_map<Key, T, Hash, KeyEqual, Allocator> >
+        : impl::map_packer< std::unordered_map<Key, T, Hash, KeyEqual, Allocator> >
+{};
+
+template <typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+struct pack_trait< std::unordered_multimap<Key, T, Hash, KeyEqual, Allocator> >
+        : impl::map_packer< std::unordered_multimap<Key, T, Hash, KeyEqual, Allocator> >
+{};
+
 // -----------------------------------------------------------------------------
 
 // Specialization for std::initializer_list
@@ -206,17 +426,27 @@ template <typename T>
 struct pack_trait< std::initializer_list<T> >
 {
     using value_t = std::initializer_list<T>;
+    using size_type = stl::collection_size_type<value_t>;
 
+    template <typename Policy = default_policy>
     static std::size_t pack(std::int8_t* dest, std::size_t offset, const value_t& list)
     {
-        offset = pack_trait<stl::collection_size_t>::pack(dest, offset, list.size());
+        offset = pack_value<Policy, size_type>(dest, offset, stl::to_collection_size<value_t>(list.size()));
 
         for(const T& item : list) {
-            offset = pack_trait<T>::pack(dest, offset, item);
+            offset = pack_value<Policy, T>(dest, offset, item);
         }
 
         return offset;
     }
+
+    // Single pass (see value_writer<T>)
+    template <typename Policy = default_policy, typename Output>
+    static void write(Output& out, const value_t& list)
+    {
+        value_writer<size_type, Policy>::write(out, stl::to_collection_size<value_t>(list.size()));
+        write_items<Policy, T>(out, list.begin(), list.end(), list.size());
+    }
 };
     
 } // namespace serialization
@@ -0,0 +1,101 @@
+#ifndef RT__SERIALIZATION__POLICY_HPP
+#define RT__SERIALIZATION__POLICY_HPP
+
+#include "ct/utils/ct_utils_byte_order.hpp"
+
+#include <type_traits> // for std::integral_constant
+
+namespace rt {
+
+namespace serialization {
+
+/**
+    Encoding of packed integers (of more than 1 byte), including collection
+    sizes:
+
+    - `fixed` - all bytes of value (`sizeof(T)`), in byte order of policy.
+    - `varint` - LEB128 (7 bits per byte, from the least significant ones),
+      signed integers are zigzag-encoded before (so small negative values are
+      short too): values less than 128 take 1 byte. Then `bytes_count()` is
+      not exact anymore - values are packed by single pass into `writer`, or
+      into buffer of `max_bytes_count_with<Policy>()` bytes (see
+      `rt_serialization_varint.hpp`).
+*/
+enum class integer_encoding
+{
+    fixed,
+    varint
+};
+
+/**
+    Compile-time configuration of packed data representation.
+
+    - `ORDER` - byte order of packed scalar values (including collection sizes).
+      With `byte_order::native` (default) values copied as-is.
+    - `ENCODING` - encoding of integers (see `integer_encoding`).
+
+    Policy passed as template parameter of `pack()` & `unpack()` functions of
+    each trait (and into `pack_with<Policy>()` & `unpack_with<Policy>()`
+    convenient functions):
+
+    @code{.cpp}
+    using big_endian_t = rt::serialization::policy< ct::utils::byte_order::big >;
+
+    rt::serialization::pack_with<big_endian_t>(bytes, values...);
+    @endcode
+
+    Custom traits with plain (non-template) `pack()` & `unpack()` functions
+    still work, but only with policies, which don't change packed data
+    (native byte order & fixed encoding - see `is_plain_policy`), otherwise
+    compilation fails by `static_assert`.
+
+    @attention Custom traits must forward `Policy` into nested traits, to make
+    policy applied for all values:
+
+    @code{.cpp}
+    template <>
+    struct pack_trait< YOUR_TYPE >
+    {
+        template <typename Policy = default_policy>
+        static std::size_t pack(std::int8_t* dest, std::size_t offset, const YOUR_TYPE& value)
+        {
+            offset = pack_value<Policy, int>(dest, offset, value.some_int);
+            // ...
+            return offset;
+        }
+    };
+    @endcode
+*/
+template <ct::utils::byte_order ORDER = ct::utils::byte_order::native, integer_encoding ENCODING = integer_encoding::fixed>
+struct policy
+{
+    static constexpr ct::utils::byte_order order = ORDER;
+    static constexpr integer_encoding encoding = ENCODING;
+};
+
+using default_policy = policy<>;
+
+// Compact profile: integers & collection sizes - as varints
+using varint_policy = policy< ct::utils::byte_order::native, integer_encoding::varint >;
+
+// Is data packed with `Policy` the same as packed without any policy (native
+// byte order & fixed encoding) - so traits without policy support may be used
+template <typename Policy>
+struct is_plain_policy
+        : std::integral_constant< bool, (Policy::order == ct::utils::byte_order::native) && (Policy::encoding == integer_encoding::fixed) >
+{};
+
+namespace impl {
+
+template <typename T>
+struct void_type {
+    using type = void;
+};
+
+} // namespace impl
+
+} // namespace serialization
+
+} // namespace rt
+
+#endif // RT__SERIALIZATION__POLICY_HPP
@@ -0,0 +1,263 @@
+#ifndef RT__SERIALIZATION__ROPE_WRITER_HPP
+#define RT__SERIALIZATION__ROPE_WRITER_HPP
+
+#include "rt/serialization/rt_serialization_pack.hpp"
+
+#include "ct/utils/ct_utils_byte_order.hpp"
+
+#include <cstddef> // for std::size_t
+#include <cstdint> // for std::int8_t
+#include <memory> // for std::unique_ptr<T>
+#include <utility> // for std::move()
+#include <vector>
+
+namespace rt {
+
+namespace serialization {
+
+/**
+    Pool of fixed-size chunks (segments of `rope_writer`). Released chunks are
+    kept and given out again, so packing of messages one after another doesn't
+    allocate memory after the first ones. Must outlive writers, which use it.
+*/
+class chunk_pool
+{
+public:
+    using byte_t = std::int8_t;
+    using chunk_t = std::unique_ptr<byte_t[]>;
+
+    // Chunk is not smaller than the biggest scalar, so every scalar item fits
+    // into single chunk
+    static constexpr std::size_t min_chunk_size = 16;
+
+    explicit chunk_pool(std::size_t chunk_size = 64 * 1024)
+        : m_chunk_size( (chunk_size < min_chunk_size) ? std::size_t{min_chunk_size} : chunk_size )
+    {}
+
+    std::size_t chunk_size() const {
+        return m_chunk_size;
+    }
+
+    // Count of released chunks, which are ready for reusing
+    std::size_t free_count() const {
+        return m_free.size();
+    }
+
+    // Note: bytes of chunk are not initialized
+    chunk_t acquire()
+    {
+        if(m_free.empty()) {
+            return chunk_t( new byte_t[m_chunk_size] );
+        }
+
+        chunk_t chunk = std::move(m_free.back());
+        m_free.pop_back();
+        return chunk;
+    }
+
+    void release(chunk_t chunk) {
+        m_free.push_back( std::move(chunk) );
+    }
+
+private:
+    std::size_t m_chunk_size;
+    std::vector<chunk_t> m_free;
+};
+
+/**
+    Segmented output of single-pass packing (like `writer`, but without
+    reallocations & copying of already written bytes). Bytes are written into
+    fixed-size chunks of `chunk_pool`, and are given out as list of slices -
+    for gathering output (`writev()`, `WSASend()`, ...) without concatenation:
+
+    @code{.cpp}
+    rt::serialization::chunk_pool pool( 64 * 1024 ); // Shared between messages
+
+    rt::serialization::rope_writer out( pool );
+    rt::serialization::pack(out, values...);
+
+    std::vector<iovec> iov;
+    for(const auto& slice : out.slices()) {
+        iov.push_back( iovec{ const_cast<std::int8_t*>(slice.data), slice.size } );
+    }
+    writev(fd, iov.data(), iov.size());
+
+    out.clear(); // Chunks are returned to pool
+    @endcode
+
+    Scalar items of containers (like `std::vector<float>`) and items of fixed
+    size (see `write_items()`) are split between chunks, so chunk size limits
+    memory used for each step. Only single value, which is packed at once and
+    is bigger than chunk, gets own segment of exact size (not from pool).
+*/
+class rope_writer
+{
+public:
+    using byte_t = std::int8_t;
+
+    struct slice
+    {
+        const byte_t* data;
+        std::size_t size;
+    };
+
+    explicit rope_writer(chunk_pool& pool)
+        : m_pool(&pool)
+    {}
+
+    rope_writer(rope_writer&& other)
+        : m_pool(other.m_pool)
+        , m_segments(std::move(other.m_segments))
+        , m_size(other.m_size)
+    {
+        other.m_segments.clear();
+        other.m_size = 0;
+    }
+
+    rope_writer& operator=(rope_writer&& other)
+    {
+        if(this != &other)
+        {
+            clear();
+            m_pool = other.m_pool;
+            m_segments = std::move(other.m_segments);
+            m_size = other.m_size;
+            other.m_segments.clear();
+            other.m_size = 0;
+        }
+        return *this;
+    }
+
+    ~rope_writer() {
+        clear();
+    }
+
+    // Appends `count` contiguous bytes, returns pointer to the first of them.
+    // Pointer is valid until `clear()`
+    byte_t* append(std::size_t count)
+    {
+        if(m_segments.empty() || (count > free_bytes_count()))
+        {
+            if(count > m_pool->chunk_size()) {
+                m_segments.push_back( segment{ chunk_pool::chunk_t( new byte_t[count] ), 0, count, false } );
+            } else {
+                add_chunk();
+            }
+        }
+
+        segment& last = m_segments.back();
+        byte_t* dest = last.data.get() + last.size;
+        last.size += count;
+        m_size += count;
+        return dest;
+    }
+
+    // Removes last `count` appended bytes (which were not written)
+    void shrink(std::size_t count)
+    {
+        if(count > 0) {
+            m_segments.back().size -= count;
+            m_size -= count;
+        }
+    }
+
+    // Appends `count` scalar items (in byte order of `Policy`, with fixed
+    // encoding - see write_scalar_items()) - they may be split between chunks
+    // (but each item is in single chunk)
+    template <typename T, typename Policy>
+    void append_items(const T* items, std::size_t count)
+    {
+        while(count > 0)
+        {
+            std::size_t fit_count = free_bytes_count() / sizeof(T);
+            if(fit_count == 0) {
+                add_chunk();
+                fit_count = m_pool->chunk_size() / sizeof(T);
+            }
+
+            const std::size_t part_count = (count < fit_count) ? count : fit_count;
+            ct::utils::byte_order_utils<Policy::order>::template copy<T>( append(sizeof(T) * part_count), items, part_count );
+
+            items += part_count;
+            count -= part_count;
+        }
+    }
+
+    // Items of fixed size are appended by chunks (see write_items())
+    std::size_t batch_bytes_count() const {
+        return m_pool->chunk_size();
+    }
+
+    // Written bytes (in order), valid until `clear()`
+    std::vector<slice> slices() const
+    {
+        std::vector<slice> result;
+        result.reserve(m_segments.size());
+
+        for(const segment& item : m_segments) {
+            if(item.size > 0) {
+                result.push_back( slice{ item.data.get(), item.size } );
+            }
+        }
+
+        return result;
+    }
+
+    // Total count of written bytes
+    std::size_t size() const {
+        return m_size;
+    }
+
+    // Returns chunks to pool. Writer may be reused after that
+    void clear()
+    {
+        for(segment& item : m_segments) {
+            if(item.is_pooled) {
+                m_pool->release( std::move(item.data) );
+            }
+        }
+
+        m_segments.clear();
+        m_size = 0;
+    }
+
+private:
+    struct segment
+    {
+        chunk_pool::chunk_t data;
+        std::size_t size;
+        std::size_t capacity;
+        bool is_pooled;
+    };
+
+    std::size_t free_bytes_count() const {
+        return m_segments.empty() ? 0 : (m_segments.back().capacity - m_segments.back().size);
+    }
+
+    void add_chunk() {
+        m_segments.push_back( segment{ m_pool->acquire(), 0, m_pool->chunk_size(), true } );
+    }
+
+    chunk_pool* m_pool;
+    std::vector<segment> m_segments;
+    std::size_t m_size = 0;
+};
+
+// Single-pass packing into segmented output
+template <typename ... Args>
+inline void pack(rope_writer& out, const Args& ... args)
+{
+    param_packer<Args...>::write(out, args...);
+}
+
+template <typename Policy, typename ... Args>
+inline void pack_with(rope_writer& out, const Args& ... args)
+{
+    param_packer<Args...>::template write<Policy>(out, args...);
+}
+
+} // namespace serialization
+
+} // namespace rt
+
+#endif // RT__SERIALIZATION__ROPE_WRITER_HPP
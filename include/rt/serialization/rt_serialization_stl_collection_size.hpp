@@ -1,7 +1,11 @@
 #ifndef RT__SERIALIZATION__STL_COLLECTION_SIZE_HPP
 #define RT__SERIALIZATION__STL_COLLECTION_SIZE_HPP
 
+#include <cstddef> // for std::size_t
 #include <cstdint> // for std::uint32_t
+#include <limits>
+#include <stdexcept> // for std::length_error
+#include <type_traits>
 
 namespace rt {
 
@@ -9,9 +13,61 @@ namespace serialization {
 
 namespace stl {
 
-// Commonly used type-alias
+// Commonly used type-alias (default type of packed collection sizes)
 using collection_size_t = std::uint32_t;
 
+/**
+    Type of packed size of `Container` - it is used by all traits of container
+    (`bytes_count_trait`, `pack_trait` and `unpack_trait`), so width of size is
+    known at compile time. May be specialized, for example:
+
+    @code{.cpp}
+    namespace rt { namespace serialization { namespace stl {
+
+    // Small bounded vectors - size takes single byte
+    template <>
+    struct collection_size_trait< std::vector<sample_t> > {
+        using type = std::uint8_t;
+    };
+
+    // Containers, which may have more than 4G items
+    template <typename T>
+    struct collection_size_trait< std::deque<T, huge_allocator<T>> > {
+        using type = std::uint64_t;
+    };
+
+    }}}
+    @endcode
+
+    Views (see `rt_serialization_views.hpp`) use size type of their owning
+    containers (`std::vector<T>`, `std::string`) by default, to be packed the
+    same way.
+*/
+template <typename Container, typename Enabled = void>
+struct collection_size_trait
+{
+    using type = collection_size_t;
+};
+
+template <typename Container>
+using collection_size_type = typename collection_size_trait<Container>::type;
+
+// Packed size of `Container` with `size` items. Size, which doesn't fit into
+// size type of container, is not truncated - std::length_error is thrown
+template <typename Container>
+inline collection_size_type<Container> to_collection_size(std::size_t size)
+{
+    using size_type = collection_size_type<Container>;
+
+    static_assert(std::is_integral<size_type>::value && std::is_unsigned<size_type>::value, "Collection size type must be unsigned integer");
+
+    if((sizeof(size_type) < sizeof(std::size_t)) && (size > static_cast<std::size_t>(std::numeric_limits<size_type>::max()))) {
+        throw std::length_error("rt::serialization: collection size doesn't fit into its packed size type");
+    }
+
+    return static_cast<size_type>(size);
+}
+
 } // namespace stl
 
 } // namespace serialization
@@ -1,10 +1,14 @@
 #ifndef RT__SERIALIZATION__UNPACK_HPP
 #define RT__SERIALIZATION__UNPACK_HPP
 
+#include "rt/serialization/rt_serialization_policy.hpp"
+#include "rt/serialization/rt_serialization_varint.hpp"
+
 #include <type_traits> // for std::enable_if<T>::type, std::is_trivially_copyable<T>::value
 
 #include <cstdint> // for std::int8_t
 #include <cstring> // for std::memcpy()
+#include <utility> // for std::declval<T>()
 
 namespace rt {
 
@@ -20,22 +24,56 @@ struct unpack_trait<T, typename std::enable_if< std::is_scalar<T>::value == true
 {
     using value_t = T;
 
-    static std::size_t unpack(const std::int8_t* src, std::size_t offset, value_t& value)
-    {
-        constexpr std::size_t BYTES_COUNT = sizeof(value_t);
-        std::memcpy(&value, (src + offset), BYTES_COUNT);
-        return offset + BYTES_COUNT;
+    template <typename Policy = default_policy>
+    static std::size_t unpack(const std::int8_t* src, std::size_t offset, value_t& value) {
+        return offset + impl::load_items<Policy>( &value, (src + offset), 1 );
     }
 };
 
+namespace impl {
+
+// Has `unpack_trait<T>` template `unpack<Policy>()` (custom traits, written
+// without policy support, have plain `unpack()`)
+template <typename T, typename Policy, typename Enabled = void>
+struct has_policy_unpack
+        : std::false_type
+{};
+
+template <typename T, typename Policy>
+struct has_policy_unpack< T, Policy, typename void_type< decltype( unpack_trait<T>::template unpack<Policy>(std::declval<const std::int8_t*>(), std::size_t{}, std::declval<T&>()) ) >::type >
+        : std::true_type
+{};
+
+template <typename Policy, typename T>
+inline std::size_t unpack_value_impl(const std::int8_t* src, std::size_t offset, T& value, std::true_type /* has_policy_unpack */) {
+    return unpack_trait<T>::template unpack<Policy>(src, offset, value);
+}
+
+template <typename Policy, typename T>
+inline std::size_t unpack_value_impl(const std::int8_t* src, std::size_t offset, T& value, std::false_type /* has_policy_unpack */)
+{
+    static_assert(is_plain_policy<Policy>::value, "rt::serialization: unpack_trait<T> without template unpack<Policy>() supports only native byte order & fixed encoding");
+    return unpack_trait<T>::unpack(src, offset, value);
+}
+
+} // namespace impl
+
+// Unpacking of single value by `unpack_trait<T>` - with `Policy`, or by plain
+// `unpack()` of custom trait without policy support
+template <typename Policy, typename T>
+inline std::size_t unpack_value(const std::int8_t* src, std::size_t offset, T& value) {
+    return impl::unpack_value_impl<Policy>(src, offset, value, impl::has_policy_unpack<T, Policy>{});
+}
+
 template <typename ... Types>
 struct param_unpacker
 {
+    template <typename Policy = default_policy>
     static std::size_t unpack(const std::int8_t* src, std::size_t offset, Types& ... values)
     {
         using dummy_t = std::size_t[];
         (void) dummy_t {
-            (offset = unpack_trait<Types>::unpack(src, offset, values), /* for debug: */ offset)...
+            (offset = unpack_value<Policy, Types>(src, offset, values), /* for debug: */ offset)...
         };
 
         return offset;
@@ -51,6 +89,13 @@ inline std::size_t unpack(const std::int8_t* bytes, Args& ... args)
     return param_unpacker<Args...>::unpack(bytes, 0, args...);
 }
 
+// The same, but with explicitly specified policy (for example - byte order)
+template <typename Policy, typename ... Args>
+inline std::size_t unpack_with(const std::int8_t* bytes, Args& ... args)
+{
+    return param_unpacker<Args...>::template unpack<Policy>(bytes, 0, args...);
+}
+
 // -----------------------------------------------------------------------------
 
 } // namespace serialization
@@ -8,6 +8,7 @@
 #include "rt/serialization/rt_serialization_stl_collection_size.hpp"
 
 #include <array>
+#include <string>
 #include <vector>
 #include <tuple>
 
@@ -15,10 +16,210 @@
 #include <forward_list>
 #include <list>
 
+#include <map>
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <cstddef>  // for std::ptrdiff_t
+#include <iterator> // for std::input_iterator_tag
+#include <tuple>    // for std::forward_as_tuple()
+#include <memory>   // for std::allocator_arg, std::uses_allocator<T, Alloc>
+#include <utility>  // for std::piecewise_construct
+
 namespace rt {
 
 namespace serialization {
 
+namespace impl {
+
+/**
+    Reads scalar items of type `T` from packed bytes (in byte order of
+    `Policy`) on access - so containers construct their items from packed bytes
+    directly, by range `assign()`, instead of `resize()` (which zero-fills
+    items) and copying over them. Items are returned by value (there are no
+    objects to refer to), so it is an input iterator - though with random
+    access operations (used by `items_view`).
+*/
+template <typename T, typename Policy>
+class packed_items_iterator
+{
+public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const T*;
+    using reference = T;
+
+    explicit packed_items_iterator(const std::int8_t* bytes)
+        : m_bytes(bytes)
+    {}
+
+    T operator*() const
+    {
+        T item;
+        load_items<Policy>(&item, m_bytes, 1);
+        return item;
+    }
+
+    T operator[](difference_type index) const {
+        return *(*this + index);
+    }
+
+    packed_items_iterator& operator++() {
+        m_bytes += sizeof(T);
+        return *this;
+    }
+
+    packed_items_iterator operator++(int) {
+        packed_items_iterator result = *this;
+        ++(*this);
+        return result;
+    }
+
+    packed_items_iterator& operator--() {
+        m_bytes -= sizeof(T);
+        return *this;
+    }
+
+    packed_items_iterator operator--(int) {
+        packed_items_iterator result = *this;
+        --(*this);
+        return result;
+    }
+
+    packed_items_iterator& operator+=(difference_type count) {
+        m_bytes += (count * static_cast<difference_type>(sizeof(T)));
+        return *this;
+    }
+
+    packed_items_iterator& operator-=(difference_type count) {
+        m_bytes -= (count * static_cast<difference_type>(sizeof(T)));
+        return *this;
+    }
+
+    packed_items_iterator operator+(difference_type count) const {
+        return packed_items_iterator(*this) += count;
+    }
+
+    packed_items_iterator operator-(difference_type count) const {
+        return packed_items_iterator(*this) -= count;
+    }
+
+    difference_type operator-(const packed_items_iterator& other) const {
+        return (m_bytes - other.m_bytes) / static_cast<difference_type>(sizeof(T));
+    }
+
+    bool operator==(const packed_items_iterator& other) const { return m_bytes == other.m_bytes; }
+    bool operator!=(const packed_items_iterator& other) const { return m_bytes != other.m_bytes; }
+    bool operator< (const packed_items_iterator& other) const { return m_bytes <  other.m_bytes; }
+    bool operator> (const packed_items_iterator& other) const { return m_bytes >  other.m_bytes; }
+    bool operator<=(const packed_items_iterator& other) const { return m_bytes <= other.m_bytes; }
+    bool operator>=(const packed_items_iterator& other) const { return m_bytes >= other.m_bytes; }
+
+private:
+    const std::int8_t* m_bytes;
+};
+
+// Unpacks `size` scalar items into sequence container: items are constructed
+// from packed bytes (by range `assign()`, without zero-filling), varints - are
+// decoded into existing (or newly created by `resize()`) items, since their
+// lengths are not known before decoding
+template <typename Policy, typename Container>
+inline std::size_t load_scalar_items(const std::int8_t* src, std::size_t offset, std::size_t size, Container& container, std::false_type /* is_varint */)
+{
+    using item_t = typename Container::value_type;
+
+    const packed_items_iterator<item_t, Policy> first(src + offset);
+    container.assign(first, first + static_cast<std::ptrdiff_t>(size));
+
+    return offset + (sizeof(item_t) * size);
+}
+
+template <typename Policy, typename Container>
+inline std::size_t load_scalar_items(const std::int8_t* src, std::size_t offset, std::size_t size, Container& container, std::true_type /* is_varint */)
+{
+    container.resize(size);
+
+    for(auto& item : container) {
+        offset += load_items<Policy>(&item, (src + offset), 1);
+    }
+
+    return offset;
+}
+
+// Contiguous items are copied as-is into reserved memory, and then swapped in
+// place at once (see `byte_order_utils::swap_in_place()`). Varints are decoded
+// by blocks (see `varint::decode_items()`)
+template <typename Policy, typename T, typename Allocator>
+inline std::size_t load_scalar_items(const std::int8_t* src, std::size_t offset, std::size_t size, std::vector<T, Allocator>& vec, std::false_type /* is_varint */)
+{
+    const packed_items_iterator<T, default_policy> first(src + offset);
+
+    vec.reserve(size);
+    vec.assign(first, first + static_cast<std::ptrdiff_t>(size));
+
+    ct::utils::byte_order_utils<Policy::order>::template swap_in_place<T>(vec.data(), size);
+
+    return offset + (sizeof(T) * size);
+}
+
+template <typename Policy, typename T, typename Allocator>
+inline std::size_t load_scalar_items(const std::int8_t* src, std::size_t offset, std::size_t size, std::vector<T, Allocator>& vec, std::true_type /* is_varint */)
+{
+    vec.resize(size);
+    return offset + load_items<Policy>(vec.data(), (src + offset), size);
+}
+
+// Range `assign()` of string builds temporary string from input iterators, so
+// characters are appended one by one instead
+template <typename Policy, typename CharT, typename Traits, typename Allocator>
+inline std::size_t load_scalar_items(const std::int8_t* src, std::size_t offset, std::size_t size, std::basic_string<CharT, Traits, Allocator>& str, std::false_type /* is_varint */)
+{
+    packed_items_iterator<CharT, default_policy> first(src + offset);
+
+    str.clear();
+    str.reserve(size);
+    for(std::size_t i = 0; i < size; ++i, ++first) {
+        str.push_back(*first);
+    }
+
+    if(size > 0) {
+        ct::utils::byte_order_utils<Policy::order>::template swap_in_place<CharT>(&str[0], size);
+    }
+
+    return offset + (sizeof(CharT) * size);
+}
+
+template <typename Policy, typename Container>
+inline std::size_t load_scalar_items(const std::int8_t* src, std::size_t offset, std::size_t size, Container& container) {
+    return load_scalar_items<Policy>(src, offset, size, container, is_varint<typename Container::value_type, Policy>{});
+}
+
+// Unpacks `size` items into sequence container: scalars - are constructed
+// from packed bytes directly (see load_scalar_items()), others - are unpacked
+// into existing (or newly created by `resize()`) items
+template <typename Policy, typename Container>
+inline std::size_t unpack_items(const std::int8_t* src, std::size_t offset, std::size_t size, Container& container, std::true_type /* is_scalar */) {
+    return load_scalar_items<Policy>(src, offset, size, container);
+}
+
+template <typename Policy, typename Container>
+inline std::size_t unpack_items(const std::int8_t* src, std::size_t offset, std::size_t size, Container& container, std::false_type /* is_scalar */)
+{
+    using item_t = typename Container::value_type;
+
+    container.resize(size);
+
+    for(item_t& item : container) {
+        offset = unpack_value<Policy, item_t>(src, offset, item);
+    }
+
+    return offset;
+}
+
+} // namespace impl
+
 // -----------------------------------------------------------------------------
 
 // Specialization for std::array (with scalar items)
@@ -26,16 +227,15 @@ template <typename T, std::size_t SIZE>
 struct unpack_trait< std::array<T, SIZE>, typename std::enable_if< std::is_scalar<T>::value == true>::type >
 {
     using value_t = std::array<T, SIZE>;
+    using size_type = stl::collection_size_type<value_t>;
 
+    template <typename Policy = default_policy>
     static std::size_t unpack(const std::int8_t* src, std::size_t offset, value_t& array)
     {
-        stl::collection_size_t size = 0; // TODO
-        offset = unpack_trait<stl::collection_size_t>::unpack(src, offset, size);
-
-        constexpr std::size_t DATA_BYTES_COUNT = (sizeof(T) * SIZE);
-        std::memcpy(array.data(), (src + offset), DATA_BYTES_COUNT);
+        size_type size = 0; // TODO
+        offset = unpack_value<Policy, size_type>(src, offset, size);
 
-        return offset += DATA_BYTES_COUNT;
+        return offset + impl::load_items<Policy>( array.data(), (src + offset), SIZE );
     }
 };
 
@@ -44,14 +244,16 @@ template <typename T, std::size_t SIZE>
 struct unpack_trait< std::array<T, SIZE>, typename std::enable_if< std::is_scalar<T>::value == false>::type >
 {
     using value_t = std::array<T, SIZE>;
+    using size_type = stl::collection_size_type<value_t>;
 
+    template <typename Policy = default_policy>
     static std::size_t unpack(const std::int8_t* src, std::size_t offset, value_t& array)
     {
-        stl::collection_size_t size = 0; // TODO
-        offset = unpack_trait<stl::collection_size_t>::unpack(src, offset, size);
+        size_type size = 0; // TODO
+        offset = unpack_value<Policy, size_type>(src, offset, size);
 
         for(T& item : array) {
-            offset = unpack_trait<T>::unpack(src, offset, item);
+            offset = unpack_value<Policy, T>(src, offset, item);
         }
 
         return offset;
@@ -61,45 +263,44 @@ struct unpack_trait< std::array<T, SIZE>, typename std::enable_if< std::is_scala
 // -----------------------------------------------------------------------------
 
 // Specialization for std::vector (with scalar items)
-template <typename T>
-struct unpack_trait< std::vector<T>, typename std::enable_if< std::is_scalar<T>::value == true>::type >
+template <typename T, typename Allocator>
+struct unpack_trait< std::vector<T, Allocator>, typename std::enable_if< std::is_scalar<T>::value == true>::type >
 {
-    using value_t = std::vector<T>;
+    using value_t = std::vector<T, Allocator>;
+    using size_type = stl::collection_size_type<value_t>;
 
+    template <typename Policy = default_policy>
     static std::size_t unpack(const std::int8_t* src, std::size_t offset, value_t& vec)
     {
         // Unpack size
-        stl::collection_size_t vec_size = 0;
-        offset = unpack_trait<stl::collection_size_t>::unpack(src, offset, vec_size);
-
-        // Resize vector for by a retreived size
-        vec.resize(vec_size);
-
-        // Copy data into vector
-        const std::size_t DATA_BYTES_COUNT = (sizeof(T) * vec_size);
-        std::memcpy(vec.data(), (src + offset), DATA_BYTES_COUNT);
+        size_type vec_size = 0;
+        offset = unpack_value<Policy, size_type>(src, offset, vec_size);
 
-        return offset += DATA_BYTES_COUNT;
+        // Items are constructed from packed bytes (without zero-filling by
+        // `resize()` and copying over them)
+        return impl::load_scalar_items<Policy>(src, offset, vec_size, vec);
     }
 };
 
 // Specialization for std::vector (with non-scalar items)
-template <typename T>
-struct unpack_trait< std::vector<T>, typename std::enable_if< std::is_scalar<T>::value == false>::type >
+template <typename T, typename Allocator>
+struct unpack_trait< std::vector<T, Allocator>, typename std::enable_if< std::is_scalar<T>::value == false>::type >
 {
-    using value_t = std::vector<T>;
+    using value_t = std::vector<T, Allocator>;
+    using size_type = stl::collection_size_type<value_t>;
 
+    template <typename Policy = default_policy>
     static std::size_t unpack(const std::int8_t* src, std::size_t offset, value_t& vec)
     {
         // Unpack size
-        stl::collection_size_t vec_size = 0;
-        offset = unpack_trait<stl::collection_size_t>::unpack(src, offset, vec_size);
+        size_type vec_size = 0;
+        offset = unpack_value<Policy, size_type>(src, offset, vec_size);
 
         // Resize vector by a retreived size
         vec.resize(vec_size);
 
         for(T& item : vec) {
-            offset = unpack_trait<T>::unpack(src, offset, item);
+            offset = unpack_value<Policy, T>(src, offset, item);
         }
 
         return offset;
@@ -114,10 +315,11 @@ struct unpack_trait< std::pair<First, Second> >
 {
     using value_t = std::pair<First, Second>;
 
+    template <typename Policy = default_policy>
     static std::size_t unpack(const std::int8_t* src, std::size_t offset, value_t& pair)
     {
-        offset = unpack_trait<First >::unpack(src, offset, pair.first);
-        offset = unpack_trait<Second>::unpack(src, offset, pair.second);
+        offset = unpack_value<Policy, First>(src, offset, pair.first);
+        offset = unpack_value<Policy, Second>(src, offset, pair.second);
         return offset;
     }
 };
@@ -129,89 +331,261 @@ struct unpack_trait< std::tuple<Types...> >
 {
     using value_t = std::tuple<Types...>;
 
-    template <int ... Indexes>
+    template <typename Policy, int ... Indexes>
     static std::size_t unpack_impl(const std::int8_t* src, std::size_t offset, value_t& tuple, ct::ind_seq::index<Indexes...>)
     {
-        return param_unpacker<Types...>::unpack(src, offset, std::get<Indexes>(tuple)...); // Unpack tuple items
+        return param_unpacker<Types...>::template unpack<Policy>(src, offset, std::get<Indexes>(tuple)...); // Unpack tuple items
     }
 
+    template <typename Policy = default_policy>
     static std::size_t unpack(const std::int8_t* src, std::size_t offset, value_t& tuple)
     {
-        return unpack_impl(src, offset, tuple, ct::ind_seq::gen_seq<sizeof...(Types)>{});
+        return unpack_impl<Policy>(src, offset, tuple, ct::ind_seq::gen_seq<sizeof...(Types)>{});
     }
 };
 
 // -----------------------------------------------------------------------------
 
 // Specialization for std::deque
-template <typename T>
-struct unpack_trait< std::deque<T> >
+template <typename T, typename Allocator>
+struct unpack_trait< std::deque<T, Allocator> >
 {
-    using value_t = std::deque<T>;
+    using value_t = std::deque<T, Allocator>;
+    using size_type = stl::collection_size_type<value_t>;
 
+    template <typename Policy = default_policy>
     static std::size_t unpack(const std::int8_t* src, std::size_t offset, value_t& deque)
     {
         // Unpack size
-        stl::collection_size_t deque_size = 0;
-        offset = unpack_trait<stl::collection_size_t>::unpack(src, offset, deque_size);
+        size_type deque_size = 0;
+        offset = unpack_value<Policy, size_type>(src, offset, deque_size);
 
-        // Resize deque by a retreived size
-        deque.resize(deque_size);
+        return impl::unpack_items<Policy>(src, offset, deque_size, deque, std::is_scalar<T>{});
+    }
+};
 
-        for(T& item : deque) {
-            offset = unpack_trait<T>::unpack(src, offset, item);
-        }
+// Specialization for std::forward_list
+template <typename T, typename Allocator>
+struct unpack_trait< std::forward_list<T, Allocator> >
+{
+    using value_t = std::forward_list<T, Allocator>;
+    using size_type = stl::collection_size_type<value_t>;
 
-        return offset;
+    template <typename Policy = default_policy>
+    static std::size_t unpack(const std::int8_t* src, std::size_t offset, value_t& list)
+    {
+        // Unpack size
+        size_type list_size = 0;
+        offset = unpack_value<Policy, size_type>(src, offset, list_size);
+
+        return impl::unpack_items<Policy>(src, offset, list_size, list, std::is_scalar<T>{});
     }
 };
 
-// Specialization for std::forward_list
-template <typename T>
-struct unpack_trait< std::forward_list<T> >
+// Specialization for std::list
+template <typename T, typename Allocator>
+struct unpack_trait< std::list<T, Allocator> >
 {
-    using value_t = std::forward_list<T>;
+    using value_t = std::list<T, Allocator>;
+    using size_type = stl::collection_size_type<value_t>;
 
+    template <typename Policy = default_policy>
     static std::size_t unpack(const std::int8_t* src, std::size_t offset, value_t& list)
     {
         // Unpack size
-        stl::collection_size_t list_size = 0;
-        offset = unpack_trait<stl::collection_size_t>::unpack(src, offset, list_size);
+        size_type list_size = 0;
+        offset = unpack_value<Policy, size_type>(src, offset, list_size);
+
+        return impl::unpack_items<Policy>(src, offset, list_size, list, std::is_scalar<T>{});
+    }
+};
+
+// Specialization for std::basic_string
+template <typename CharT, typename Traits, typename Allocator>
+struct unpack_trait< std::basic_string<CharT, Traits, Allocator> >
+{
+    using value_t = std::basic_string<CharT, Traits, Allocator>;
+    using size_type = stl::collection_size_type<value_t>;
+
+    template <typename Policy = default_policy>
+    static std::size_t unpack(const std::int8_t* src, std::size_t offset, value_t& str)
+    {
+        // Unpack size
+        size_type str_size = 0;
+        offset = unpack_value<Policy, size_type>(src, offset, str_size);
+
+        return assign<Policy>(src, offset, str_size, str, std::integral_constant<bool, sizeof(CharT) == 1>{});
+    }
+
+private:
+    // Single-byte characters - string is built from packed bytes by single
+    // bulk copy (without zero-filling by `resize()`)
+    template <typename Policy>
+    static std::size_t assign(const std::int8_t* src, std::size_t offset, std::size_t size, value_t& str, std::true_type /* is_single_byte */)
+    {
+        str.assign(reinterpret_cast<const CharT*>(src + offset), size);
+        return offset + size;
+    }
+
+    // Wider characters - may be unaligned in packed bytes, or have other byte
+    // order (see impl::load_items())
+    template <typename Policy>
+    static std::size_t assign(const std::int8_t* src, std::size_t offset, std::size_t size, value_t& str, std::false_type /* is_single_byte */) {
+        return impl::load_scalar_items<Policy>(src, offset, size, str);
+    }
+};
+
+// -----------------------------------------------------------------------------
+// Associative containers (see bytes_count_trait)
+
+namespace impl {
+
+// Hashed containers - buckets are allocated once, by packed size
+template <typename Container>
+inline void reserve_items(Container& container, std::size_t size, std::true_type /* is_hashed */) {
+    container.reserve(size);
+}
+
+template <typename Container>
+inline void reserve_items(Container& , std::size_t , std::false_type /* is_hashed */)
+{}
+
+// Creates temporary key, which uses allocator of container, if key is
+// allocator-aware (for example - arena string or vector) - the same way, as
+// allocator is passed to items of sequence containers by `resize()` (see
+// `std::scoped_allocator_adaptor`, `std::pmr::polymorphic_allocator`)
+template <typename Key, typename Allocator>
+inline Key construct_key(const Allocator& allocator, std::true_type /* is_leading_allocator */) {
+    return Key(std::allocator_arg, allocator);
+}
+
+template <typename Key, typename Allocator>
+inline Key construct_key(const Allocator& allocator, std::false_type /* is_leading_allocator */) {
+    return Key(allocator);
+}
+
+template <typename Key, typename Allocator>
+inline Key make_key(const Allocator& allocator, std::true_type /* uses_allocator */) {
+    return construct_key<Key>(allocator, std::is_constructible<Key, std::allocator_arg_t, const Allocator&>{});
+}
+
+template <typename Key, typename Allocator>
+inline Key make_key(const Allocator& , std::false_type /* uses_allocator */) {
+    return Key();
+}
+
+template <typename Key, typename Allocator>
+inline Key make_key(const Allocator& allocator) {
+    return make_key<Key>(allocator, std::uses_allocator<Key, Allocator>{});
+}
+
+/*
+    Items are inserted with hint `end()`: keys of ordered containers are packed
+    in sorted order, so each insertion is amortized O(1) (instead of O(log n)).
+    For hashed containers hint is ignored.
+*/
+template <typename Set, bool IS_HASHED>
+struct set_unpacker
+{
+    using key_t = typename Set::key_type;
+    using size_type = stl::collection_size_type<Set>;
+
+    template <typename Policy = default_policy>
+    static std::size_t unpack(const std::int8_t* src, std::size_t offset, Set& set)
+    {
+        // Unpack size
+        size_type set_size = 0;
+        offset = unpack_value<Policy, size_type>(src, offset, set_size);
+
+        set.clear();
+        reserve_items(set, set_size, std::integral_constant<bool, IS_HASHED>{});
 
-        // Resize vector a retreived size
-        list.resize(list_size);
+        for(size_type i = 0; i < set_size; ++i)
+        {
+            key_t key = make_key<key_t>( set.get_allocator() );
+            offset = unpack_value<Policy, key_t>(src, offset, key);
 
-        for(T& item : list) {
-            offset = unpack_trait<T>::unpack(src, offset, item);
+            set.emplace_hint(set.end(), std::move(key));
         }
 
         return offset;
     }
 };
 
-// Specialization for std::list
-template <typename T>
-struct unpack_trait< std::list<T> >
+template <typename Map, bool IS_HASHED>
+struct map_unpacker
 {
-    using value_t = std::list<T>;
+    using key_t = typename Map::key_type;
+    using size_type = stl::collection_size_type<Map>;
+    using mapped_t = typename Map::mapped_type;
 
-    static std::size_t unpack(const std::int8_t* src, std::size_t offset, value_t& list)
+    template <typename Policy = default_policy>
+    static std::size_t unpack(const std::int8_t* src, std::size_t offset, Map& map)
     {
         // Unpack size
-        stl::collection_size_t list_size = 0;
-        offset = unpack_trait<stl::collection_size_t>::unpack(src, offset, list_size);
+        size_type map_size = 0;
+        offset = unpack_value<Policy, size_type>(src, offset, map_size);
+
+        map.clear();
+        reserve_items(map, map_size, std::integral_constant<bool, IS_HASHED>{});
 
-        // Resize vector a retreived size
-        list.resize(list_size);
+        for(size_type i = 0; i < map_size; ++i)
+        {
+            key_t key = make_key<key_t>( map.get_allocator() );
+            offset = unpack_value<Policy, key_t>(src, offset, key);
 
-        for(T& item : list) {
-            offset = unpack_trait<T>::unpack(src, offset, item);
+            // Mapped value is created in place (by allocator of map) and is
+            // unpacked into it
+            const auto item = map.emplace_hint(map.end(), std::piecewise_construct, std::forward_as_tuple(std::move(key)), std::forward_as_tuple());
+            offset = unpack_value<Policy, mapped_t>(src, offset, item->second);
         }
 
         return offset;
     }
 };
 
+} // namespace impl
+
+template <typename Key, typename Compare, typename Allocator>
+struct unpack_trait< std::set<Key, Compare, Allocator> >
+        : impl::set_unpacker< std::set<Key, Compare, Allocator>, false >
+{};
+
+template <typename Key, typename Compare, typename Allocator>
+struct unpack_trait< std::multiset<Key, Compare, Allocator> >
+        : impl::set_unpacker< std::multiset<Key, Compare, Allocator>, false >
+{};
+
+template <typename Key, typename Hash, typename KeyEqual, typename Allocator>
+struct unpack_trait< std::unordered_set<Key, Hash, KeyEqual, Allocator> >
+        : impl::set_unpacker< std::unordered_set<Key, Hash, KeyEqual, Allocator>, true >
+{};
+
+template <typename Key, typename Hash, typename KeyEqual, typename Allocator>
+struct unpack_trait< std::unordered_multiset<Key, Hash, KeyEqual, Allocator> >
+        : impl::set_unpacker< std::unordered_multiset<Key, Hash, KeyEqual, Allocator>, true >
+{};
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+struct unpack_trait< std::map<Key, T, Compare, Allocator> >
+        : impl::map_unpacker< std::map<Key, T, Compare, Allocator>, false >
+{};
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+struct unpack_trait< std::multimap<Key, T, Compare, Allocator> >
+        : impl::map_unpacker< std::multimap<Key, T, Compare, Allocator>, false >
+{};
+
+template <typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+struct unpack_trait< std::unordered_map<Key, T, Hash, KeyEqual, Allocator> >
+        : impl::map_unpacker< std::unordered_map<Key, T, Hash, KeyEqual, Allocator>, true >
+{};
+
+template <typename Key, typename T, typename Hash, typename KeyEqual, typename Allocator>
+struct unpack_trait< std::unordered_multimap<Key, T, Hash, KeyEqual, Allocator> >
+        : impl::map_unpacker< std::unordered_multimap<Key, T, Hash, KeyEqual, Allocator>, true >
+{};
+
 // -----------------------------------------------------------------------------
 
 // Specialization for std::initializer_list
@@ -223,15 +597,17 @@ template <typename T>
 struct unpack_trait< std::initializer_list<T> >
 {
     using value_t = std::initializer_list<T>;
+    using size_type = stl::collection_size_type<value_t>;
 
+    template <typename Policy = default_policy>
     static std::size_t unpack(const std::int8_t* src, std::size_t offset, value_t& list)
     {
         // Unpack size (TODO: unused)
-        stl::collection_size_t list_size = 0;
-        offset += unpack_trait<stl::collection_size_t>::unpack(src, offset, list_size);
+        size_type list_size = 0;
+        offset += unpack_trait<size_type>::template unpack<Policy>(src, offset, list_size);
 
         for(const T& item : list) {
-            offset += unpack_trait<T>::unpack(src, offset, item);
+            offset += unpack_trait<T>::template unpack<Policy>(src, offset, item);
         }
 
         return offset;
@@ -0,0 +1,268 @@
+#ifndef RT__SERIALIZATION__VARINT_HPP
+#define RT__SERIALIZATION__VARINT_HPP
+
+#include "rt/serialization/rt_serialization_policy.hpp"
+
+#include <cstddef> // for std::size_t
+#include <cstdint> // for std::int8_t, std::uint8_t, std::uint64_t
+#include <cstring> // for std::memcpy()
+#include <type_traits>
+
+#if defined(__SSE2__)
+    #include <emmintrin.h> // for _mm_movemask_epi8()
+#endif
+
+/**
+    Variable-length encoding of integers (`integer_encoding::varint`, see
+    `varint_policy`):
+
+    @code{.cpp}
+    rt::serialization::writer out;
+    rt::serialization::pack_with<rt::serialization::varint_policy>(out, values...);
+
+    rt::serialization::unpack_with<rt::serialization::varint_policy>(bytes.data(), values...);
+    @endcode
+
+    Only integers of more than 1 byte are encoded (floating point values, `bool`
+    and characters - including `wchar_t`, `char16_t` and `char32_t` - are
+    packed as-is). Encoded value takes at most 1.5 of its size (3 bytes for
+    16-bit, 5 for 32-bit and 10 for 64-bit integers) - that is upper bound of
+    `max_bytes_count_with<Policy>()`.
+
+    Arrays of integers are decoded by blocks: runs of 16 (SSE2) or 8 values,
+    which are less than 128 (the most common case), are decoded at once -
+    without per-byte branches.
+*/
+
+namespace rt {
+
+namespace serialization {
+
+namespace impl {
+
+// Is `T` a wide character type (narrow characters are 1 byte anyway)
+template <typename T>
+struct is_wide_char
+        : std::integral_constant<bool, std::is_same<T, wchar_t>::value || std::is_same<T, char16_t>::value || std::is_same<T, char32_t>::value>
+{};
+
+// Is `T` encoded as varint by `Policy`
+template <typename T, typename Policy>
+struct is_varint
+        : std::integral_constant<bool, (Policy::encoding == integer_encoding::varint) && std::is_integral<T>::value && (sizeof(T) > 1) && !is_wide_char<T>::value>
+{};
+
+// Upper bound of packed bytes count of values, which take `bytes_count` bytes
+// with fixed encoding
+template <typename Policy>
+constexpr std::size_t max_packed_bytes_count(std::size_t bytes_count) {
+    return (Policy::encoding == integer_encoding::varint) ? (bytes_count + (bytes_count / 2)) : bytes_count;
+}
+
+} // namespace impl
+
+namespace varint {
+
+template <typename T>
+using unsigned_t = typename std::make_unsigned<T>::type;
+
+// Max bytes count of encoded value of type `T`
+template <typename T>
+constexpr std::size_t max_bytes_count() {
+    return ((sizeof(T) * 8) + 6) / 7;
+}
+
+// Zigzag encoding of signed values: 0, -1, 1, -2, ... --> 0, 1, 2, 3, ...
+template <typename T>
+inline unsigned_t<T> to_unsigned(T value, std::true_type /* is_signed */)
+{
+    const unsigned_t<T> bits = static_cast< unsigned_t<T> >(value);
+    return static_cast< unsigned_t<T> >( static_cast< unsigned_t<T> >(bits << 1) ^ static_cast< unsigned_t<T> >(0U - (bits >> ((sizeof(T) * 8) - 1))) );
+}
+
+template <typename T>
+inline unsigned_t<T> to_unsigned(T value, std::false_type /* is_signed */) {
+    return value;
+}
+
+template <typename T>
+inline T from_unsigned(unsigned_t<T> bits, std::true_type /* is_signed */) {
+    return static_cast<T>( static_cast< unsigned_t<T> >( (bits >> 1) ^ static_cast< unsigned_t<T> >(0U - (bits & 1U)) ) );
+}
+
+template <typename T>
+inline T from_unsigned(unsigned_t<T> bits, std::false_type /* is_signed */) {
+    return bits;
+}
+
+// Encodes `value` into `dest`, returns count of written bytes
+template <typename T>
+inline std::size_t encode(std::int8_t* dest, T value)
+{
+    unsigned_t<T> bits = to_unsigned(value, std::is_signed<T>{});
+
+    std::size_t count = 0;
+    while(bits >= 0x80U)
+    {
+        dest[count++] = static_cast<std::int8_t>( static_cast<std::uint8_t>(bits | 0x80U) );
+        bits = static_cast< unsigned_t<T> >(bits >> 7);
+    }
+    dest[count++] = static_cast<std::int8_t>(bits);
+
+    return count;
+}
+
+// Decodes `value` from `src`, returns count of read bytes
+template <typename T>
+inline std::size_t decode(const std::int8_t* src, T& value)
+{
+    const std::uint8_t* bytes = reinterpret_cast<const std::uint8_t*>(src);
+
+    unsigned_t<T> bits = static_cast< unsigned_t<T> >(bytes[0] & 0x7FU);
+
+    std::size_t count = 1;
+    for(; ((bytes[count - 1] & 0x80U) != 0) && (count < max_bytes_count<T>()); ++count) {
+        bits = static_cast< unsigned_t<T> >( bits | (static_cast< unsigned_t<T> >(bytes[count] & 0x7FU) << (7 * count)) );
+    }
+
+    value = from_unsigned<T>(bits, std::is_signed<T>{});
+    return count;
+}
+
+template <typename T>
+inline std::size_t encode_items(std::int8_t* dest, const T* items, std::size_t count)
+{
+    std::size_t offset = 0;
+    for(std::size_t i = 0; i < count; ++i) {
+        offset += encode(dest + offset, items[i]);
+    }
+    return offset;
+}
+
+// Decodes `count` values, returns count of read bytes. Note: each encoded
+// value takes at least 1 byte, so there are at least `count` readable bytes
+template <typename T>
+inline std::size_t decode_items(T* items, const std::int8_t* src, std::size_t count)
+{
+    const std::uint8_t* bytes = reinterpret_cast<const std::uint8_t*>(src);
+
+    std::size_t offset = 0;
+    std::size_t i = 0;
+
+    while(i < count)
+    {
+#if defined(__SSE2__)
+        // 16 single-byte values (no continuation bits)
+        if((count - i) >= 16)
+        {
+            const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + offset));
+            if(_mm_movemask_epi8(block) == 0)
+            {
+                for(std::size_t b = 0; b < 16; ++b) {
+                    items[i + b] = from_unsigned<T>(bytes[offset + b], std::is_signed<T>{});
+                }
+                i += 16;
+                offset += 16;
+                continue;
+            }
+        }
+#endif
+        // 8 single-byte values
+        if((count - i) >= 8)
+        {
+            std::uint64_t block = 0;
+            std::memcpy(&block, bytes + offset, sizeof(block));
+            if((block & 0x8080808080808080ULL) == 0)
+            {
+                for(std::size_t b = 0; b < 8; ++b) {
+                    items[i + b] = from_unsigned<T>(bytes[offset + b], std::is_signed<T>{});
+                }
+                i += 8;
+                offset += 8;
+                continue;
+            }
+        }
+
+        offset += decode(src + offset, items[i]);
+        ++i;
+    }
+
+    return offset;
+}
+
+} // namespace varint
+
+namespace impl {
+
+// Packing & unpacking of scalar items by `Policy` - returns count of written
+// (read) bytes. Items of empty container may be null (which can't be passed
+// to `std::memcpy()` even with zero count), so they aren't copied at all
+template <typename Policy, typename T>
+inline std::size_t store_items(std::int8_t* dest, const T* items, std::size_t count, std::false_type /* is_varint */)
+{
+    if(count > 0) {
+        ct::utils::byte_order_utils<Policy::order>::template copy<T>(dest, items, count);
+    }
+    return sizeof(T) * count;
+}
+
+template <typename Policy, typename T>
+inline std::size_t store_items(std::int8_t* dest, const T* items, std::size_t count, std::true_type /* is_varint */) {
+    return varint::encode_items(dest, items, count);
+}
+
+template <typename Policy, typename T>
+inline std::size_t store_items(std::int8_t* dest, const T* items, std::size_t count) {
+    return store_items<Policy>(dest, items, count, is_varint<T, Policy>{});
+}
+
+template <typename Policy, typename T>
+inline std::size_t load_items(T* items, const std::int8_t* src, std::size_t count, std::false_type /* is_varint */)
+{
+    if(count > 0) {
+        ct::utils::byte_order_utils<Policy::order>::template copy<T>(items, src, count);
+    }
+    return sizeof(T) * count;
+}
+
+template <typename Policy, typename T>
+inline std::size_t load_items(T* items, const std::int8_t* src, std::size_t count, std::true_type /* is_varint */) {
+    return varint::decode_items(items, src, count);
+}
+
+template <typename Policy, typename T>
+inline std::size_t load_items(T* items, const std::int8_t* src, std::size_t count) {
+    return load_items<Policy>(items, src, count, is_varint<T, Policy>{});
+}
+
+} // namespace impl
+
+// -----------------------------------------------------------------------------
+
+#if defined(CT_ENABLE_TESTS)
+namespace tests {
+
+    static_assert( varint::max_bytes_count<std::uint16_t>() == 3, "Test failed");
+    static_assert( varint::max_bytes_count<std::int32_t>() == 5, "Test failed");
+    static_assert( varint::max_bytes_count<std::uint64_t>() == 10, "Test failed");
+
+    static_assert( impl::is_varint<std::int32_t, varint_policy>::value == true, "Test failed");
+    static_assert( impl::is_varint<std::int8_t, varint_policy>::value == false, "Test failed");
+    static_assert( impl::is_varint<float, varint_policy>::value == false, "Test failed");
+    static_assert( impl::is_varint<std::int32_t, default_policy>::value == false, "Test failed");
+    static_assert( impl::is_varint<char16_t, varint_policy>::value == false, "Test failed");
+    static_assert( impl::is_varint<char32_t, varint_policy>::value == false, "Test failed");
+    static_assert( impl::is_varint<wchar_t, varint_policy>::value == false, "Test failed");
+
+    static_assert( impl::max_packed_bytes_count<varint_policy>(8) >= varint::max_bytes_count<std::uint64_t>(), "Test failed");
+    static_assert( impl::max_packed_bytes_count<varint_policy>(4) >= varint::max_bytes_count<std::uint32_t>(), "Test failed");
+    static_assert( impl::max_packed_bytes_count<varint_policy>(2) >= varint::max_bytes_count<std::uint16_t>(), "Test failed");
+
+} // namespace tests
+#endif // defined(CT_ENABLE_TESTS)
+
+} // namespace serialization
+
+} // namespace rt
+
+#endif // RT__SERIALIZATION__VARINT_HPP
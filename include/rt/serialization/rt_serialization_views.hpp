@@ -0,0 +1,384 @@
+#ifndef RT__SERIALIZATION__VIEWS_HPP
+#define RT__SERIALIZATION__VIEWS_HPP
+
+#include "rt/serialization/rt_serialization_bytes_count.hpp"
+#include "rt/serialization/rt_serialization_pack.hpp"
+#include "rt/serialization/rt_serialization_unpack_stl.hpp"
+
+#include "rt/serialization/rt_serialization_stl_collection_size.hpp"
+
+#include <cstddef> // for std::size_t, std::ptrdiff_t
+#include <cstdint> // for std::int8_t
+#include <cstring> // for std::memcpy(), std::memcmp(), std::strlen()
+#include <string>
+#include <vector>
+#include <type_traits>
+
+#if defined(__has_include)
+    #if (__cplusplus >= 201703L) && __has_include(<string_view>)
+        #include <string_view>
+    #endif
+#endif
+
+/**
+    Non-owning views of packed data - unpacking into them doesn't allocate and
+    copy, views just point into source bytes (so they are valid while source
+    bytes are alive):
+
+    - `items_view<T, Policy>` - scalar items (packed like `std::vector<T>`),
+      which are read from source bytes on access (in byte order of `Policy`,
+      without alignment requirements);
+    - `chars_view` - character data (packed like `std::vector<char>`), and
+      `std::string_view` (C++17).
+
+    @code{.cpp}
+    rt::serialization::items_view<float> samples;
+    rt::serialization::chars_view name;
+
+    rt::serialization::unpack(bytes.data(), samples, name); // No allocations
+
+    for(float sample : samples) { ... }
+    @endcode
+
+    Views may be packed too (the same bytes, as of owning containers).
+*/
+
+namespace rt {
+
+namespace serialization {
+
+template <typename T, typename Policy = default_policy>
+class items_view
+{
+    static_assert(std::is_scalar<T>::value == true, "T must be a scalar type");
+    static_assert(impl::is_varint<T, Policy>::value == false, "Varints can't be read in place");
+
+public:
+    using value_type = T;
+    using const_iterator = impl::packed_items_iterator<T, Policy>;
+    using iterator = const_iterator;
+
+    items_view() = default;
+
+    // `bytes` - packed items (without size)
+    items_view(const std::int8_t* bytes, std::size_t size)
+        : m_bytes(bytes)
+        , m_size(size)
+    {}
+
+    std::size_t size() const {
+        return m_size;
+    }
+
+    bool empty() const {
+        return (m_size == 0);
+    }
+
+    // Packed bytes of items
+    const std::int8_t* bytes() const {
+        return m_bytes;
+    }
+
+    std::size_t bytes_count() const {
+        return sizeof(T) * m_size;
+    }
+
+    T operator[](std::size_t index) const {
+        return *(begin() + static_cast<std::ptrdiff_t>(index));
+    }
+
+    const_iterator begin() const {
+        return const_iterator(m_bytes);
+    }
+
+    const_iterator end() const {
+        return begin() + static_cast<std::ptrdiff_t>(m_size);
+    }
+
+    // Copies all items into `dest` (by bulk copying of bytes)
+    void copy_to(T* dest) const {
+        ct::utils::byte_order_utils<Policy::order>::template copy<T>(dest, m_bytes, m_size);
+    }
+
+private:
+    const std::int8_t* m_bytes = nullptr;
+    std::size_t m_size = 0;
+};
+
+class chars_view
+{
+public:
+    using value_type = char;
+    using const_iterator = const char*;
+    using iterator = const_iterator;
+
+    chars_view() = default;
+
+    chars_view(const char* data, std::size_t size)
+        : m_data(data)
+        , m_size(size)
+    {}
+
+    chars_view(const char* str)
+        : m_data(str)
+        , m_size(std::strlen(str))
+    {}
+
+    chars_view(const std::string& str)
+        : m_data(str.data())
+        , m_size(str.size())
+    {}
+
+    const char* data() const {
+        return m_data;
+    }
+
+    std::size_t size() const {
+        return m_size;
+    }
+
+    bool empty() const {
+        return (m_size == 0);
+    }
+
+    char operator[](std::size_t index) const {
+        return m_data[index];
+    }
+
+    const_iterator begin() const {
+        return m_data;
+    }
+
+    const_iterator end() const {
+        return m_data + m_size;
+    }
+
+    std::string str() const {
+        return std::string(m_data, m_size);
+    }
+
+#if defined(__cpp_lib_string_view)
+    operator std::string_view() const {
+        return std::string_view(m_data, m_size);
+    }
+#endif
+
+private:
+    const char* m_data = nullptr;
+    std::size_t m_size = 0;
+};
+
+inline bool operator==(const chars_view& l, const chars_view& r) {
+    return (l.size() == r.size()) && ((l.size() == 0) || (std::memcmp(l.data(), r.data(), l.size()) == 0));
+}
+
+inline bool operator!=(const chars_view& l, const chars_view& r) {
+    return !(l == r);
+}
+
+// -----------------------------------------------------------------------------
+
+namespace stl {
+
+// Views are packed like owning containers - with the same size types
+
+template <typename T, typename ViewPolicy>
+struct collection_size_trait< items_view<T, ViewPolicy> >
+{
+    using type = collection_size_type< std::vector<T> >;
+};
+
+template <>
+struct collection_size_trait< chars_view >
+{
+    using type = collection_size_type< std::string >;
+};
+
+#if defined(__cpp_lib_string_view)
+template <>
+struct collection_size_trait< std::string_view >
+{
+    using type = collection_size_type< std::string >;
+};
+#endif
+
+} // namespace stl
+
+// -----------------------------------------------------------------------------
+
+namespace impl {
+
+// Packing & unpacking of contiguous characters (like `std::vector<char>`),
+// with packed size type of `View`
+template <typename View>
+struct chars_trait
+{
+    using size_type = stl::collection_size_type<View>;
+
+    static std::size_t bytes_count(std::size_t size) {
+        return sizeof(size_type) + size;
+    }
+
+    template <typename Policy>
+    static std::size_t pack(std::int8_t* dest, std::size_t offset, const char* data, std::size_t size)
+    {
+        offset = pack_value<Policy, size_type>(dest, offset, stl::to_collection_size<View>(size));
+
+        if(size > 0) {
+            std::memcpy( (dest + offset), data, size );
+        }
+
+        return offset + size;
+    }
+
+    template <typename Policy>
+    static std::size_t unpack(const std::int8_t* src, std::size_t offset, const char*& data, std::size_t& size)
+    {
+        size_type chars_count = 0;
+        offset = unpack_value<Policy, size_type>(src, offset, chars_count);
+
+        data = reinterpret_cast<const char*>(src + offset);
+        size = chars_count;
+
+        return offset + size;
+    }
+};
+
+} // namespace impl
+
+// -----------------------------------------------------------------------------
+
+template <typename T, typename ViewPolicy>
+struct bytes_count_trait< items_view<T, ViewPolicy> >
+{
+    using value_t = items_view<T, ViewPolicy>;
+
+    static std::size_t bytes_count(const value_t& view) {
+        return sizeof(stl::collection_size_type<value_t>) + view.bytes_count();
+    }
+};
+
+template <typename T, typename ViewPolicy>
+struct pack_trait< items_view<T, ViewPolicy> >
+{
+    using value_t = items_view<T, ViewPolicy>;
+    using size_type = stl::collection_size_type<value_t>;
+
+    template <typename Policy = default_policy>
+    static std::size_t pack(std::int8_t* dest, std::size_t offset, const value_t& view)
+    {
+        offset = pack_value<Policy, size_type>(dest, offset, stl::to_collection_size<value_t>(view.size()));
+
+        // The same representation - packed bytes are copied as is
+        if((ViewPolicy::order == Policy::order) && (impl::is_varint<T, Policy>::value == false))
+        {
+            if(view.size() > 0) {
+                std::memcpy( (dest + offset), view.bytes(), view.bytes_count() );
+            }
+            return offset + view.bytes_count();
+        }
+
+        for(const T item : view) {
+            offset = pack_value<Policy, T>(dest, offset, item);
+        }
+
+        return offset;
+    }
+};
+
+template <typename T, typename ViewPolicy>
+struct unpack_trait< items_view<T, ViewPolicy> >
+{
+    using value_t = items_view<T, ViewPolicy>;
+    using size_type = stl::collection_size_type<value_t>;
+
+    template <typename Policy = default_policy>
+    static std::size_t unpack(const std::int8_t* src, std::size_t offset, value_t& view)
+    {
+        static_assert(ViewPolicy::order == Policy::order, "Byte order of view must be the same as of unpacking");
+        static_assert(impl::is_varint<T, Policy>::value == false, "Varints can't be read in place");
+
+        size_type size = 0;
+        offset = unpack_value<Policy, size_type>(src, offset, size);
+
+        view = value_t( (src + offset), size );
+
+        return offset + view.bytes_count();
+    }
+};
+
+// -----------------------------------------------------------------------------
+
+template <>
+struct bytes_count_trait< chars_view >
+{
+    static std::size_t bytes_count(const chars_view& view) {
+        return impl::chars_trait<chars_view>::bytes_count(view.size());
+    }
+};
+
+template <>
+struct pack_trait< chars_view >
+{
+    template <typename Policy = default_policy>
+    static std::size_t pack(std::int8_t* dest, std::size_t offset, const chars_view& view) {
+        return impl::chars_trait<chars_view>::pack<Policy>(dest, offset, view.data(), view.size());
+    }
+};
+
+template <>
+struct unpack_trait< chars_view >
+{
+    template <typename Policy = default_policy>
+    static std::size_t unpack(const std::int8_t* src, std::size_t offset, chars_view& view)
+    {
+        const char* data = nullptr;
+        std::size_t size = 0;
+        offset = impl::chars_trait<chars_view>::unpack<Policy>(src, offset, data, size);
+
+        view = chars_view(data, size);
+        return offset;
+    }
+};
+
+#if defined(__cpp_lib_string_view)
+
+template <>
+struct bytes_count_trait< std::string_view >
+{
+    static std::size_t bytes_count(const std::string_view& view) {
+        return impl::chars_trait<std::string_view>::bytes_count(view.size());
+    }
+};
+
+template <>
+struct pack_trait< std::string_view >
+{
+    template <typename Policy = default_policy>
+    static std::size_t pack(std::int8_t* dest, std::size_t offset, const std::string_view& view) {
+        return impl::chars_trait<std::string_view>::pack<Policy>(dest, offset, view.data(), view.size());
+    }
+};
+
+template <>
+struct unpack_trait< std::string_view >
+{
+    template <typename Policy = default_policy>
+    static std::size_t unpack(const std::int8_t* src, std::size_t offset, std::string_view& view)
+    {
+        const char* data = nullptr;
+        std::size_t size = 0;
+        offset = impl::chars_trait<std::string_view>::unpack<Policy>(src, offset, data, size);
+
+        view = std::string_view(data, size);
+        return offset;
+    }
+};
+
+#endif // defined(__cpp_lib_string_view)
+
+} // namespace serialization
+
+} // namespace rt
+
+#endif // RT__SERIALIZATION__VIEWS_HPP
@@ -0,0 +1,139 @@
+#ifndef RT__SERIALIZATION__WRITER_HPP
+#define RT__SERIALIZATION__WRITER_HPP
+
+#include "ct/utils/ct_utils_byte_order.hpp"
+
+#include <cstddef> // for std::size_t
+#include <cstdint> // for std::int8_t
+#include <limits>
+#include <memory> // for std::allocator
+#include <new>
+#include <type_traits>
+#include <utility> // for std::move(), std::forward()
+#include <vector>
+
+namespace rt {
+
+namespace serialization {
+
+// Allocator, which default-initializes values without arguments (instead of
+// value-initialization) - so bytes, appended by `resize()`, are not zero-filled
+// before being written
+template <typename T, typename Allocator = std::allocator<T>>
+class default_init_allocator : public Allocator
+{
+    using traits_t = std::allocator_traits<Allocator>;
+
+public:
+    template <typename U>
+    struct rebind {
+        using other = default_init_allocator< U, typename traits_t::template rebind_alloc<U> >;
+    };
+
+    using Allocator::Allocator;
+
+    template <typename U>
+    void construct(U* ptr) noexcept(std::is_nothrow_default_constructible<U>::value) {
+        ::new (static_cast<void*>(ptr)) U;
+    }
+
+    template <typename U, typename ... Args>
+    void construct(U* ptr, Args&& ... args) {
+        traits_t::construct(static_cast<Allocator&>(*this), ptr, std::forward<Args>(args)...);
+    }
+};
+
+/**
+    Growable bytes buffer - destination of single-pass packing (instead of
+    `bytes_count()` + `pack()` two-pass protocol, which walks through all
+    nested containers twice):
+
+    @code{.cpp}
+    rt::serialization::writer out( 4096 ); // Optional capacity hint
+
+    rt::serialization::pack(out, values...);
+
+    rt::serialization::writer::buffer_t bytes = out.release(); // No copying
+    @endcode
+
+    Buffer grows geometrically (amortized O(1) per appended byte). Traits
+    append bytes by `append(count)` and write them by returned pointer - see
+    `pack_trait<T>::write()`. Appended bytes are not zero-filled (see
+    `default_init_allocator`), since all of them are written right after.
+*/
+class writer
+{
+public:
+    using byte_t = std::int8_t;
+    using buffer_t = std::vector< byte_t, default_init_allocator<byte_t> >;
+
+    explicit writer(std::size_t capacity_hint = 0)
+    {
+        m_buffer.reserve(capacity_hint);
+    }
+
+    // Appends `count` bytes, returns pointer to the first of them. Pointer is
+    // valid until next appending
+    byte_t* append(std::size_t count)
+    {
+        const std::size_t size = m_buffer.size();
+        m_buffer.resize(size + count);
+        return m_buffer.data() + size;
+    }
+
+    // Removes last `count` appended bytes (which were not written)
+    void shrink(std::size_t count) {
+        m_buffer.resize(m_buffer.size() - count);
+    }
+
+    // Appends `count` scalar items (in byte order of `Policy`, with fixed
+    // encoding - see write_scalar_items())
+    template <typename T, typename Policy>
+    void append_items(const T* items, std::size_t count)
+    {
+        if(count == 0) {
+            return; // `items` of empty container may be null
+        }
+
+        ct::utils::byte_order_utils<Policy::order>::template copy<T>( append(sizeof(T) * count), items, count );
+    }
+
+    // Items of fixed size are appended at once (see write_items())
+    std::size_t batch_bytes_count() const {
+        return std::numeric_limits<std::size_t>::max();
+    }
+
+    void reserve(std::size_t capacity) {
+        m_buffer.reserve(capacity);
+    }
+
+    const byte_t* data() const {
+        return m_buffer.data();
+    }
+
+    std::size_t size() const {
+        return m_buffer.size();
+    }
+
+    std::size_t capacity() const {
+        return m_buffer.capacity();
+    }
+
+    // Returns written bytes (by moving, without copying). Writer is empty after
+    // that, and may be reused
+    buffer_t release()
+    {
+        buffer_t result = std::move(m_buffer);
+        m_buffer.clear();
+        return result;
+    }
+
+private:
+    buffer_t m_buffer;
+};
+
+} // namespace serialization
+
+} // namespace rt
+
+#endif // RT__SERIALIZATION__WRITER_HPP
@@ -0,0 +1,150 @@
+#include "catch.hpp"
+
+#include "ct/serialization/ct_serialization_pack.hpp"
+#include "ct/serialization/ct_serialization_unpack.hpp"
+#include "ct/serialization/ct_serialization_view.hpp"
+
+#include <cstring>
+
+// Note: this file is compiled as C++17 (if supported by compiler)
+
+#if CT_HAS_AGGREGATE_DECOMPOSITION
+
+namespace {
+
+using big_endian_t = ct::serialization::policy< ct::utils::byte_order::big >;
+
+// Without padding - packed as single value
+struct vec3
+{
+    float x;
+    float y;
+    float z;
+};
+
+// With padding (after `id`) - packed field-by-field
+struct particle
+{
+    std::int8_t id;
+    vec3 position;
+    std::array<std::int16_t, 2> flags;
+    std::pair<std::int8_t, double> extra;
+};
+
+bool operator==(const vec3& l, const vec3& r) {
+    return (l.x == r.x) && (l.y == r.y) && (l.z == r.z);
+}
+
+bool operator==(const particle& l, const particle& r) {
+    return (l.id == r.id) && (l.position == r.position) && (l.flags == r.flags) && (l.extra == r.extra);
+}
+
+} // namespace
+
+TEST_CASE( "Compile-time Plain aggregates Serialization/Deserialization works", "[ct][ser/deser][aggregate]" )
+{
+    const particle value { 7, {1.5f, 2.5f, 3.5f}, {{-1, 2}}, {3, 4.25} };
+
+    const auto bytes = ct::serialization::pack(value);
+
+    SECTION( "Aggregates are packed as tuples of their fields" )
+    {
+        constexpr std::size_t PACKED_BYTES_COUNT = (1 + (4 * 3) + (2 * 2) + (1 + 8));
+
+        REQUIRE( bytes.size() == PACKED_BYTES_COUNT );
+
+        const auto expected = ct::serialization::pack( std::tuple< std::int8_t, std::tuple<float, float, float>, std::array<std::int16_t, 2>, std::pair<std::int8_t, double> >(
+            value.id, std::make_tuple(value.position.x, value.position.y, value.position.z), value.flags, value.extra
+        ));
+
+        REQUIRE( bytes == expected );
+    }
+
+    SECTION( "Aggregate without padding is a single flattened value" )
+    {
+        constexpr std::size_t FLAT_COUNT = ct::flattened<particle>::type::count;
+
+        REQUIRE( FLAT_COUNT == (1 + 1 + 1 + 2) );
+        REQUIRE( ct::is_packed_aggregate<vec3>::value == true );
+        REQUIRE( ct::is_packed_aggregate<particle>::value == false );
+    }
+
+    SECTION( "Unpacking produces the same data" )
+    {
+        particle unpacked {};
+        ct::serialization::unpack(bytes, unpacked);
+
+        REQUIRE( unpacked == value );
+    }
+
+    SECTION( "Byte order policy is respected for fields of aggregates without padding" )
+    {
+        const auto big_endian_bytes = ct::serialization::pack_with<big_endian_t>(value);
+
+        std::uint32_t x_bits = 0;
+        std::memcpy(&x_bits, &value.position.x, sizeof(x_bits));
+
+        REQUIRE( static_cast<std::uint8_t>(big_endian_bytes[1]) == ((x_bits >> 24) & 0xFF) );
+        REQUIRE( static_cast<std::uint8_t>(big_endian_bytes[4]) == (x_bits & 0xFF) );
+
+        particle unpacked {};
+        ct::serialization::unpack_with<big_endian_t>(big_endian_bytes, unpacked);
+
+        REQUIRE( unpacked == value );
+    }
+}
+
+TEST_CASE( "Compile-time Arrays of aggregates without padding are packed as single block", "[ct][ser/deser][aggregate]" )
+{
+    using mesh_t = std::array<vec3, 4>;
+
+    const mesh_t mesh { { {1.f, 2.f, 3.f}, {4.f, 5.f, 6.f}, {7.f, 8.f, 9.f}, {10.f, 11.f, 12.f} } };
+
+    SECTION( "Array is single flattened value" )
+    {
+        constexpr std::size_t FLAT_COUNT = ct::flattened<std::int8_t, mesh_t>::type::count;
+
+        REQUIRE( FLAT_COUNT == 2 );
+    }
+
+    SECTION( "Bytes are the same as in memory" )
+    {
+        const auto bytes = ct::serialization::pack(std::int8_t{1}, mesh);
+
+        REQUIRE( bytes.size() == (1 + sizeof(mesh_t)) );
+        REQUIRE( std::memcmp(bytes.data() + 1, mesh.data(), sizeof(mesh_t)) == 0 );
+
+        std::int8_t head = 0;
+        mesh_t unpacked {};
+        ct::serialization::unpack(bytes, head, unpacked);
+
+        REQUIRE( head == 1 );
+        REQUIRE( unpacked == mesh );
+    }
+
+    SECTION( "Items are read by view" )
+    {
+        const auto bytes = ct::serialization::pack(std::int8_t{1}, mesh);
+
+        const ct::serialization::view<std::int8_t, mesh_t> view(bytes);
+
+        REQUIRE( view.get<1, 2>() == mesh[2] );
+    }
+
+    SECTION( "Byte order policy is respected for items" )
+    {
+        const auto big_endian_bytes = ct::serialization::pack_with<big_endian_t>(mesh);
+        const auto expected = ct::serialization::pack_with<big_endian_t>(
+            std::array<float, 12>{ {1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f, 9.f, 10.f, 11.f, 12.f} }
+        );
+
+        REQUIRE( big_endian_bytes == expected );
+
+        mesh_t unpacked {};
+        ct::serialization::unpack_with<big_endian_t>(big_endian_bytes, unpacked);
+
+        REQUIRE( unpacked == mesh );
+    }
+}
+
+#endif // CT_HAS_AGGREGATE_DECOMPOSITION
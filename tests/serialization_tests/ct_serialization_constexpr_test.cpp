@@ -0,0 +1,93 @@
+#include "catch.hpp"
+
+#include "ct/serialization/ct_serialization_pack.hpp"
+#include "ct/serialization/ct_serialization_unpack.hpp"
+
+// Note: this file is compiled as C++20 (if supported by compiler)
+
+#if CT_HAS_CONSTEXPR_PACKING
+
+namespace {
+
+using big_endian_t = ct::serialization::policy< ct::utils::byte_order::big >;
+using aligned_t    = ct::serialization::policy< ct::utils::byte_order::native, ct::serialization::fields_layout::aligned >;
+
+using frame_t = std::tuple< std::uint16_t, std::pair<std::int8_t, float>, std::array<std::int32_t, 3> >;
+
+constexpr frame_t default_frame { 0x0102, {3, 2.5f}, {4, 5, 6} };
+
+// Baked at compile-time
+constexpr auto default_frame_bytes = ct::serialization::pack(default_frame);
+
+#if CT_HAS_AGGREGATE_DECOMPOSITION
+// Plain aggregate without padding
+struct point
+{
+    std::int16_t x;
+    std::int16_t y;
+};
+#endif
+
+} // namespace
+
+TEST_CASE( "Compile-time (constexpr) Serialization/Deserialization works", "[ct][ser/deser][constexpr]" )
+{
+    SECTION( "Packing at compile-time produces the same bytes as at run-time" )
+    {
+        static_assert( default_frame_bytes.size() == (2 + 1 + 4 + (4 * 3)), "Test failed");
+
+        frame_t frame = default_frame; // Not constexpr
+        const auto bytes = ct::serialization::pack(frame);
+
+        REQUIRE( bytes == default_frame_bytes );
+    }
+
+    SECTION( "Unpacking at compile-time produces the same data" )
+    {
+        constexpr auto frame = ct::serialization::unpack_as_tuple<frame_t>(default_frame_bytes);
+
+        static_assert( std::get<0>(frame) == default_frame, "Test failed");
+
+        REQUIRE( std::get<0>(frame) == default_frame );
+    }
+
+    SECTION( "Policies are respected at compile-time" )
+    {
+        constexpr auto big_endian_bytes = ct::serialization::pack_with<big_endian_t>(std::uint16_t{0x0102}, std::uint32_t{0x03040506});
+
+        static_assert( big_endian_bytes[0] == 1 && big_endian_bytes[1] == 2, "Test failed");
+        static_assert( big_endian_bytes[2] == 3 && big_endian_bytes[5] == 6, "Test failed");
+
+        constexpr auto aligned_bytes = ct::serialization::pack_with<aligned_t>(std::int8_t{1}, std::int32_t{2});
+
+        static_assert( aligned_bytes.size() == 8, "Test failed");
+        static_assert( aligned_bytes[1] == 0, "Test failed"); // Padding is zeroed
+
+        std::uint16_t v0 = 0;
+        std::uint32_t v1 = 0;
+        ct::serialization::unpack_with<big_endian_t>(big_endian_bytes, v0, v1);
+
+        REQUIRE( v0 == 0x0102 );
+        REQUIRE( v1 == 0x03040506 );
+    }
+
+#if CT_HAS_AGGREGATE_DECOMPOSITION
+    SECTION( "Plain aggregates are packed at compile-time" )
+    {
+        constexpr auto native_bytes = ct::serialization::pack( std::array<point, 2>{ { {0x0102, 0x0304}, {0x0506, 0x0708} } } );
+        constexpr auto big_endian_bytes = ct::serialization::pack_with<big_endian_t>( point{0x0102, 0x0304} );
+
+        static_assert( big_endian_bytes[0] == 1 && big_endian_bytes[3] == 4, "Test failed");
+
+        constexpr auto points = ct::serialization::unpack_as_tuple< std::array<point, 2> >(native_bytes);
+
+        static_assert( std::get<0>(points)[1].y == 0x0708, "Test failed");
+
+        const std::array<point, 2> runtime_points { { {0x0102, 0x0304}, {0x0506, 0x0708} } }; // Not constexpr
+
+        REQUIRE( ct::serialization::pack(runtime_points) == native_bytes );
+    }
+#endif
+}
+
+#endif // CT_HAS_CONSTEXPR_PACKING
@@ -2,6 +2,32 @@
 
 #include "ct/serialization/ct_serialization_pack.hpp"
 #include "ct/serialization/ct_serialization_unpack.hpp"
+#include "ct/serialization/ct_serialization_columnar.hpp"
+#include "ct/serialization/ct_serialization_view.hpp"
+
+#include <vector>
+#include <algorithm> // for std::equal()
+#include <cstring> // for std::memcpy()
+
+namespace {
+
+using big_endian_t = ct::serialization::policy< ct::utils::byte_order::big >;
+
+// Packs values with `Policy` and checks, that unpacking with the same policy
+// produces the same data. Returns packed bytes - for checks of their layout
+template <typename Policy, typename ... Args>
+auto require_same_unpacked_with(const Args& ... args) -> decltype( ct::serialization::pack_with<Policy>(args...) )
+{
+    const auto bytes = ct::serialization::pack_with<Policy>(args...);
+
+    std::tuple<Args...> unpacked {};
+    ct::serialization::unpack_from_with<Policy>(bytes.data(), unpacked);
+
+    REQUIRE( unpacked == std::tie(args...) );
+    return bytes;
+}
+
+} // namespace
 
 TEST_CASE( "Compile-time offsets calculation works", "[ct][ser/deser]")
 {
@@ -295,3 +321,454 @@ TEST_CASE( "Structures Serialization/Deserialization works", "[ct][ser/deser]" )
         REQUIRE(col_unpacked.b == 254 );
     }
 }
+
+TEST_CASE( "Compile-time Range Serialization/Deserialization works", "[ct][ser/deser][range]" )
+{
+    using record_t = std::tuple
+    <
+        std::uint32_t,
+        float,
+        std::array<std::int16_t, 3>,
+        std::pair<std::int8_t, double>
+    >;
+
+    constexpr std::size_t RECORDS_COUNT = 100;
+    constexpr std::size_t STRIDE = ct::serialization::packed_bytes_count<record_t>();
+
+    std::vector<record_t> records;
+    for(std::size_t i = 0; i < RECORDS_COUNT; ++i)
+    {
+        const std::int16_t v = static_cast<std::int16_t>(i);
+        records.push_back( record_t{ std::uint32_t(i * 3), float(i) * 0.5f, {v, std::int16_t(v+1), std::int16_t(v+2)}, {std::int8_t(i % 100), double(i) * 0.25} } );
+    }
+
+    std::vector<std::int8_t> bytes(RECORDS_COUNT * STRIDE);
+    const std::size_t packed_count = ct::serialization::pack_range(bytes.data(), records.begin(), records.end());
+
+    SECTION( "Packed bytes count is correct" )
+    {
+        REQUIRE( packed_count == (RECORDS_COUNT * STRIDE) );
+    }
+
+    SECTION( "Each record packed the same way as single record" )
+    {
+        const auto single = ct::serialization::pack(records[42]);
+        REQUIRE( std::equal(single.begin(), single.end(), bytes.begin() + (42 * STRIDE)) );
+    }
+
+    SECTION( "Range unpacking produces the same data" )
+    {
+        std::vector<record_t> unpacked(RECORDS_COUNT);
+        const auto it = ct::serialization::unpack_range(bytes.data(), RECORDS_COUNT, unpacked.begin());
+
+        REQUIRE( it == unpacked.end() );
+        REQUIRE( unpacked == records );
+    }
+
+    SECTION( "Records without fields take no bytes" )
+    {
+        std::vector< std::tuple<> > empty_records(3);
+
+        REQUIRE( ct::serialization::pack_range(bytes.data(), empty_records.begin(), empty_records.end()) == 0 );
+        REQUIRE( ct::serialization::unpack_range(bytes.data(), empty_records.size(), empty_records.begin()) == empty_records.end() );
+    }
+}
+
+TEST_CASE( "Compile-time Columnar Serialization/Deserialization works", "[ct][ser/deser][columnar]" )
+{
+    using record_t = std::tuple
+    <
+        std::uint32_t,
+        std::pair<std::int8_t, double>,
+        std::array<std::int16_t, 2>
+    >;
+    using columnar_t = ct::serialization::columnar_trait<record_t>;
+
+    constexpr std::size_t RECORDS_COUNT = 10;
+
+    std::vector<record_t> records;
+    for(std::size_t i = 0; i < RECORDS_COUNT; ++i)
+    {
+        const std::int16_t v = static_cast<std::int16_t>(i);
+        records.push_back( record_t{ std::uint32_t(i * 3), {std::int8_t(i), double(i) * 0.25}, {v, std::int16_t(-v)} } );
+    }
+
+    std::vector<std::int8_t> bytes( columnar_t::bytes_count(RECORDS_COUNT) );
+    const std::size_t packed_count = ct::serialization::pack_columns(bytes.data(), records.begin(), records.end());
+
+    SECTION( "Packed bytes count is the same as for row-major packing" )
+    {
+        REQUIRE( packed_count == (RECORDS_COUNT * ct::serialization::packed_bytes_count<record_t>()) );
+    }
+
+    SECTION( "Each column contains continuous values of single field" )
+    {
+        const std::int8_t* doubles = bytes.data() + columnar_t::column_offset<2>(RECORDS_COUNT);
+
+        for(std::size_t i = 0; i < RECORDS_COUNT; ++i)
+        {
+            double value = 0.0;
+            std::memcpy(&value, doubles + (i * sizeof(double)), sizeof(double));
+            REQUIRE( value == Approx(double(i) * 0.25) );
+        }
+    }
+
+    SECTION( "Columnar unpacking produces the same data" )
+    {
+        std::vector<record_t> unpacked(RECORDS_COUNT);
+        ct::serialization::unpack_columns(bytes.data(), RECORDS_COUNT, unpacked.begin());
+
+        REQUIRE( unpacked == records );
+    }
+
+    SECTION( "Columns of aligned layout are aligned and separated by zeroed gaps" )
+    {
+        using aligned_t = ct::serialization::policy< ct::utils::byte_order::native, ct::serialization::fields_layout::aligned >;
+        using aligned_columnar_t = ct::serialization::columnar_trait< ct::serialization::with_policy<aligned_t, record_t> >;
+
+        // Offsets: [0, 4, 8, 16], record bytes count: 24
+        std::vector<std::int8_t> aligned_bytes( aligned_columnar_t::bytes_count(RECORDS_COUNT), std::int8_t{0x55} );
+        const std::size_t aligned_count = ct::serialization::pack_columns_with<aligned_t>(aligned_bytes.data(), records.begin(), records.end());
+
+        REQUIRE( aligned_count == (RECORDS_COUNT * 24) );
+        REQUIRE( aligned_columnar_t::column_offset<2>(RECORDS_COUNT) == (RECORDS_COUNT * 8) );
+        REQUIRE( (aligned_columnar_t::column_offset<2>(RECORDS_COUNT) % alignof(double)) == 0 );
+
+        // Gaps after `i8` column and after the last column
+        for(std::size_t i = (RECORDS_COUNT * (4 + 1)); i < (RECORDS_COUNT * 8); ++i) {
+            REQUIRE( aligned_bytes[i] == 0 );
+        }
+        for(std::size_t i = (RECORDS_COUNT * (16 + 4)); i < aligned_count; ++i) {
+            REQUIRE( aligned_bytes[i] == 0 );
+        }
+
+        const std::int8_t* aligned_doubles = aligned_bytes.data() + aligned_columnar_t::column_offset<2>(RECORDS_COUNT);
+        REQUIRE( std::equal(aligned_doubles, aligned_doubles + (RECORDS_COUNT * sizeof(double)), bytes.data() + columnar_t::column_offset<2>(RECORDS_COUNT)) );
+
+        std::vector<record_t> unpacked(RECORDS_COUNT);
+        ct::serialization::unpack_columns_with<aligned_t>(aligned_bytes.data(), RECORDS_COUNT, unpacked.begin());
+
+        REQUIRE( unpacked == records );
+    }
+
+    SECTION( "Columnar unpacking with reordered layout produces the same data" )
+    {
+        using reordered_t = ct::serialization::policy< ct::utils::byte_order::native, ct::serialization::fields_layout::reordered >;
+        using reordered_columnar_t = ct::serialization::columnar_trait< ct::serialization::with_policy<reordered_t, record_t> >;
+
+        std::vector<std::int8_t> reordered_bytes( reordered_columnar_t::bytes_count(RECORDS_COUNT) );
+        ct::serialization::pack_columns_with<reordered_t>(reordered_bytes.data(), records.begin(), records.end());
+
+        // `double` column goes first
+        REQUIRE( reordered_columnar_t::column_offset<2>(RECORDS_COUNT) == 0 );
+
+        std::vector<record_t> unpacked(RECORDS_COUNT);
+        ct::serialization::unpack_columns_with<reordered_t>(reordered_bytes.data(), RECORDS_COUNT, unpacked.begin());
+
+        REQUIRE( unpacked == records );
+    }
+}
+
+TEST_CASE( "Compile-time Byte order policy works", "[ct][ser/deser][byte_order]" )
+{
+    using little_endian_t = ct::serialization::policy< ct::utils::byte_order::little >;
+
+    const std::uint32_t value = 0x01020304;
+    const std::array<std::uint16_t, 9> array = {0x0506, 0x0708, 0x090A, 0x0B0C, 0x0D0E, 0x0F10, 0x1112, 0x1314, 0x1516};
+    const std::pair<std::int8_t, std::uint64_t> pair = {0x17, 0x18191A1B1C1D1E1F};
+
+    SECTION( "Values packed in big-endian byte order" )
+    {
+        const auto bytes = require_same_unpacked_with<big_endian_t>(value, array, pair);
+
+        REQUIRE( bytes.size() == (4 + (2*9) + (1+8)) );
+        for(std::size_t i = 0; i < bytes.size(); ++i) {
+            REQUIRE( bytes[i] == static_cast<std::int8_t>(i + 1) );
+        }
+    }
+
+    SECTION( "Values packed in little-endian byte order" )
+    {
+        const auto bytes = ct::serialization::pack_with<little_endian_t>(value);
+
+        REQUIRE( bytes[0] == 0x04 );
+        REQUIRE( bytes[3] == 0x01 );
+    }
+
+    SECTION( "Native byte order is the same as without policy" )
+    {
+        using native_t = ct::serialization::policy< ct::utils::byte_order::native >;
+        REQUIRE( ct::serialization::pack_with<native_t>(value, array, pair) == ct::serialization::pack(value, array, pair) );
+    }
+}
+
+TEST_CASE( "Compile-time Aligned fields layout works", "[ct][ser/deser][layout]" )
+{
+    using aligned_t = ct::serialization::policy< ct::utils::byte_order::native, ct::serialization::fields_layout::aligned >;
+    using info_t = ct::serialization::utils::types_sizeofs_info<
+        ct::serialization::with_policy<aligned_t, std::int8_t, std::pair<std::int32_t, std::int16_t>, std::array<std::int64_t, 2> >
+    >;
+
+    SECTION( "Fields placed at aligned offsets" )
+    {
+        constexpr auto offsets = info_t::get_offsets();
+
+        REQUIRE( offsets.size() == 4 );
+        REQUIRE( offsets[0] == 0 );
+        REQUIRE( offsets[1] == 4 );
+        REQUIRE( offsets[2] == 8 );
+        REQUIRE( offsets[3] == 16 );
+
+        constexpr std::size_t bytes_count = info_t::bytes_count;
+        constexpr std::size_t alignment   = info_t::alignment;
+        constexpr std::size_t buffer_alignment = alignof(info_t::byte_buffer_t);
+
+        REQUIRE( bytes_count == 32 );
+        REQUIRE( alignment == alignof(std::int64_t) );
+        REQUIRE( buffer_alignment == alignof(std::int64_t) );
+    }
+
+    SECTION( "Values are written at their offsets" )
+    {
+        const std::int8_t v0 = 1;
+        const std::pair<std::int32_t, std::int16_t> v1 = {2, 3};
+        const std::array<std::int64_t, 2> v2 = {4, 5};
+
+        const auto bytes = require_same_unpacked_with<aligned_t>(v0, v1, v2);
+        REQUIRE( bytes.size() == 32 );
+
+        std::int32_t v1_first = 0;
+        std::memcpy(&v1_first, bytes.data() + 4, sizeof(std::int32_t));
+        REQUIRE( v1_first == 2 );
+    }
+
+    SECTION( "Padding bytes are zeroed" )
+    {
+        info_t::byte_buffer_t bytes;
+        bytes.fill( static_cast<std::int8_t>(0xAB) ); // Previous contents of buffer
+
+        ct::serialization::pack_into_with<aligned_t>(bytes.data(), std::int8_t{1}, std::pair<std::int32_t, std::int16_t>{2, 3}, std::array<std::int64_t, 2>{{4, 5}});
+
+        for(std::size_t i : {1, 2, 3, 10, 11, 12, 13, 14, 15}) {
+            REQUIRE( bytes[i] == 0 );
+        }
+    }
+}
+
+TEST_CASE( "Compile-time Reordered fields layout works", "[ct][ser/deser][layout]" )
+{
+    using reordered_t = ct::serialization::policy< ct::utils::byte_order::native, ct::serialization::fields_layout::reordered >;
+    using info_t = ct::serialization::utils::types_sizeofs_info<
+        ct::serialization::with_policy<reordered_t, std::int8_t, std::pair<std::int16_t, std::int64_t>, std::array<std::int32_t, 3> >
+    >;
+
+    SECTION( "Fields placed by decreasing alignment" )
+    {
+        constexpr auto offsets = info_t::get_offsets();
+
+        REQUIRE( offsets.size() == 4 );
+        REQUIRE( offsets[0] == 22 );
+        REQUIRE( offsets[1] == 20 );
+        REQUIRE( offsets[2] ==  0 );
+        REQUIRE( offsets[3] ==  8 );
+
+        constexpr std::size_t bytes_count = info_t::bytes_count;
+        constexpr std::size_t buffer_alignment = alignof(info_t::byte_buffer_t);
+
+        REQUIRE( bytes_count == 24 );
+        REQUIRE( buffer_alignment == alignof(std::int64_t) );
+    }
+
+    SECTION( "Values are written at their offsets" )
+    {
+        const std::int8_t v0 = 1;
+        const std::pair<std::int16_t, std::int64_t> v1 = {2, 3};
+        const std::array<std::int32_t, 3> v2 = {4, 5, 6};
+
+        const auto bytes = require_same_unpacked_with<reordered_t>(v0, v1, v2);
+        REQUIRE( bytes.size() == 24 );
+
+        std::int64_t v1_second = 0;
+        std::memcpy(&v1_second, bytes.data(), sizeof(std::int64_t));
+        REQUIRE( v1_second == 3 );
+    }
+
+    SECTION( "Padding bytes are zeroed" )
+    {
+        info_t::byte_buffer_t bytes;
+        bytes.fill( static_cast<std::int8_t>(0xAB) ); // Previous contents of buffer
+
+        ct::serialization::pack_into_with<reordered_t>(bytes.data(), std::int8_t{1}, std::pair<std::int16_t, std::int64_t>{2, 3}, std::array<std::int32_t, 3>{{4, 5, 6}});
+
+        REQUIRE( bytes[23] == 0 );
+    }
+}
+
+TEST_CASE( "Compile-time Zero-copy view works", "[ct][ser/deser][view]" )
+{
+    using pair_t  = std::pair<std::int8_t, std::array<std::int16_t, 2>>;
+    using items_t = std::array<std::pair<std::int8_t, std::int64_t>, 2>;
+
+    const std::int32_t v0 = 1;
+    const pair_t v1 = {2, {3, 4}};
+    const items_t v2 = {{ {5, 6}, {7, 8} }};
+
+    auto bytes = ct::serialization::pack(v0, v1, v2);
+
+    SECTION( "Single fields are read by path" )
+    {
+        const ct::serialization::view<std::int32_t, pair_t, items_t> view(bytes);
+
+        REQUIRE( view.get<0>() == v0 );
+        REQUIRE( view.get<1>() == v1 );
+        REQUIRE( view.get<1, 0>() == 2 );
+        REQUIRE( view.get<1, 1>() == v1.second );
+        REQUIRE( view.get<1, 1, 1>() == 4 );
+        REQUIRE( view.get<2, 0, 1>() == 6 );
+        REQUIRE( view.get<2, 1>() == v2[1] );
+        REQUIRE( view.get<2, 1, 1>() == 8 );
+    }
+
+    SECTION( "Single fields are written by path, without touching others" )
+    {
+        const ct::serialization::mutable_view<std::int32_t, pair_t, items_t> view(bytes);
+
+        view.set<1, 1, 0>( std::int16_t{30} );
+        view.set<2, 1>( std::make_pair(std::int8_t{70}, std::int64_t{80}) );
+
+        std::int32_t v0_unpacked = 0;
+        pair_t v1_unpacked = {};
+        items_t v2_unpacked = {};
+
+        ct::serialization::unpack(bytes, v0_unpacked, v1_unpacked, v2_unpacked);
+
+        REQUIRE( v0_unpacked == v0 );
+        REQUIRE( v1_unpacked == pair_t{2, {30, 4}} );
+        REQUIRE( v2_unpacked == items_t{{ {5, 6}, {70, 80} }} );
+    }
+
+    SECTION( "Policy is respected" )
+    {
+        const auto big_endian_bytes = ct::serialization::pack_with<big_endian_t>(v0, v1, v2);
+        const ct::serialization::view< ct::serialization::with_policy<big_endian_t, std::int32_t, pair_t, items_t> > view(big_endian_bytes);
+
+        REQUIRE( big_endian_bytes[3] == 1 );
+        REQUIRE( view.get<0>() == v0 );
+        REQUIRE( view.get<1, 1, 1>() == 4 );
+        REQUIRE( view.get<2, 1, 1>() == 8 );
+    }
+}
+
+TEST_CASE( "Compile-time Big non-scalar arrays are packed by loop", "[ct][ser/deser][unroll]" )
+{
+    constexpr std::size_t ITEMS_COUNT = CT_ARRAY_UNROLL_THRESHOLD + 1;
+
+    using item_t  = std::pair<std::int32_t, std::int8_t>;
+    using items_t = std::array<item_t, ITEMS_COUNT>;
+
+    static_assert( ct::is_looped_array<items_t>::value, "Test failed");
+
+    const std::int16_t head = 0x0102;
+    items_t items = {};
+    for(std::size_t i = 0; i < items.size(); ++i) {
+        items[i] = item_t{ static_cast<std::int32_t>(i * 1000), static_cast<std::int8_t>(i % 100) };
+    }
+
+    SECTION( "Items are placed densely, as if array was unrolled" )
+    {
+        const auto bytes = ct::serialization::pack(head, items);
+
+        REQUIRE( bytes.size() == (2 + ITEMS_COUNT * (4 + 1)) );
+
+        const std::size_t last = ITEMS_COUNT - 1;
+        std::int32_t first_value = 0;
+        std::memcpy(&first_value, bytes.data() + 2 + (last * 5), sizeof(first_value));
+
+        REQUIRE( first_value == items[last].first );
+        REQUIRE( bytes[2 + (last * 5) + 4] == items[last].second );
+    }
+
+    SECTION( "Unpacking produces the same data" )
+    {
+        const auto bytes = ct::serialization::pack(head, items);
+
+        std::int16_t head_unpacked = 0;
+        items_t items_unpacked = {};
+
+        ct::serialization::unpack(bytes, head_unpacked, items_unpacked);
+
+        REQUIRE( head_unpacked == head );
+        REQUIRE( items_unpacked == items );
+    }
+
+    SECTION( "Byte order policy is respected for items" )
+    {
+        const auto bytes = require_same_unpacked_with<big_endian_t>(head, items);
+
+        REQUIRE( bytes[0] == 0x01 );
+        REQUIRE( bytes[2 + 5 + 3] == static_cast<std::int8_t>(1000 & 0xFF) ); // Lowest byte of items[1].first is the last one
+    }
+
+    SECTION( "Fields after items stay aligned in reordered layout" )
+    {
+        using reordered_t = ct::serialization::policy< ct::utils::byte_order::native, ct::serialization::fields_layout::reordered >;
+        using info_t = ct::serialization::utils::types_sizeofs_info< ct::serialization::with_policy<reordered_t, std::int8_t, items_t, std::int32_t> >;
+
+        // Items are packed densely (5 bytes each), so their size is not
+        // multiple of alignment - padded up to it
+        constexpr std::size_t items_bytes_count = ((ITEMS_COUNT * (4 + 1)) + 3) / 4 * 4;
+
+        constexpr auto offsets = info_t::get_offsets();
+        REQUIRE( offsets[1] == 0 );
+        REQUIRE( offsets[2] == items_bytes_count );
+        REQUIRE( offsets[0] == items_bytes_count + 4 );
+        REQUIRE( (offsets[2] % alignof(std::int32_t)) == 0 );
+
+        require_same_unpacked_with<reordered_t>(std::int8_t{7}, items, std::int32_t{0x0A0B0C0D});
+    }
+}
+
+TEST_CASE( "Compile-time Records with thousands of fields work", "[ct][ser/deser][unroll]" )
+{
+    // Unrolled (each row is below CT_ARRAY_UNROLL_THRESHOLD): 2 * 250 * 2 = 1000
+    // flattened fields - more than default constexpr evaluation depth (512)
+    using row_t    = std::array<std::pair<std::int8_t, std::int16_t>, 250>;
+    using record_t = std::array<row_t, 2>;
+
+    static_assert( ct::flattened<record_t>::type::count == 1000, "Test failed");
+
+    record_t record = {};
+    for(std::size_t row = 0; row < record.size(); ++row) {
+        for(std::size_t i = 0; i < record[row].size(); ++i) {
+            record[row][i] = std::make_pair( static_cast<std::int8_t>(row), static_cast<std::int16_t>(i) );
+        }
+    }
+
+    SECTION( "Packed layout" )
+    {
+        const auto bytes = ct::serialization::pack(record);
+        REQUIRE( bytes.size() == (2 * 250 * (1 + 2)) );
+
+        record_t record_unpacked = {};
+        ct::serialization::unpack(bytes, record_unpacked);
+
+        REQUIRE( record_unpacked == record );
+    }
+
+    // Offsets of these layouts are calculated with log depth too (C++11)
+    SECTION( "Aligned layout" )
+    {
+        using aligned_t = ct::serialization::policy< ct::utils::byte_order::native, ct::serialization::fields_layout::aligned >;
+
+        const auto bytes = require_same_unpacked_with<aligned_t>(record);
+        REQUIRE( bytes.size() == (2 * 250 * (2 + 2)) );
+    }
+
+    SECTION( "Reordered layout" )
+    {
+        using reordered_t = ct::serialization::policy< ct::utils::byte_order::native, ct::serialization::fields_layout::reordered >;
+
+        const auto bytes = require_same_unpacked_with<reordered_t>(record);
+        REQUIRE( bytes.size() == (2 * 250 * (1 + 2)) );
+    }
+}
@@ -9,6 +9,21 @@
 #include "rt/serialization/rt_serialization_unpack.hpp"
 #include "rt/serialization/rt_serialization_unpack_stl.hpp"
 
+#include "rt/serialization/rt_serialization_arena.hpp"
+#include "rt/serialization/rt_serialization_members.hpp"
+#include "rt/serialization/rt_serialization_rope_writer.hpp"
+#include "rt/serialization/rt_serialization_views.hpp"
+
+#include <cstring> // for std::memcpy()
+#include <limits>
+#include <stdexcept>
+
+namespace {
+
+using big_endian_t = rt::serialization::policy< ct::utils::byte_order::big >;
+
+} // namespace
+
 
 TEST_CASE( "Run-time buffer size calculation works", "[rt][ser/deser]")
 {
@@ -82,6 +97,33 @@ TEST_CASE( "Run-time buffer size calculation works", "[rt][ser/deser]")
                 + (sizeof(int));
         REQUIRE( size == BYTES_COUNT );
     }
+
+    SECTION( "Containers of fixed-size items are counted without walking through items" )
+    {
+        using item_t = std::pair< std::int32_t, std::array<float, 2> >;
+
+        constexpr bool IS_ITEM_FIXED = rt::serialization::fixed_bytes_count_trait<item_t>::is_fixed;
+        constexpr std::size_t ITEM_BYTES_COUNT = rt::serialization::fixed_bytes_count_trait<item_t>::bytes_count;
+
+        REQUIRE( IS_ITEM_FIXED == true );
+        REQUIRE( ITEM_BYTES_COUNT == (4 + (sizeof(std::uint32_t) + (4 * 2))) );
+
+        constexpr bool IS_VECTOR_FIXED = rt::serialization::fixed_bytes_count_trait< std::vector<item_t> >::is_fixed;
+        constexpr bool IS_TUPLE_FIXED = rt::serialization::fixed_bytes_count_trait< std::tuple<int, std::vector<int>> >::is_fixed;
+
+        REQUIRE( IS_VECTOR_FIXED == false );
+        REQUIRE( IS_TUPLE_FIXED == false );
+
+        const std::vector<item_t> vec(1000);
+        const std::forward_list<item_t> fwd_list(10);
+
+        REQUIRE( rt::serialization::bytes_count(vec) == (sizeof(std::uint32_t) + (1000 * ITEM_BYTES_COUNT)) );
+        REQUIRE( rt::serialization::bytes_count(fwd_list) == (sizeof(std::uint32_t) + (10 * ITEM_BYTES_COUNT)) );
+
+        // Items of variable size are still walked
+        const std::vector< std::vector<std::int8_t> > nested = { {1}, {2, 3}, {} };
+        REQUIRE( rt::serialization::bytes_count(nested) == (sizeof(std::uint32_t) + (3 * sizeof(std::uint32_t)) + 3) );
+    }
 }
 
 template <typename ... Args>
@@ -95,6 +137,28 @@ inline std::vector<std::int8_t> pack_into_bytes(const Args& ... args)
     return bytes;
 }
 
+// Packs values with `Policy` (by single pass & into buffer - bytes must be the
+// same) and checks, that unpacking with the same policy produces the same data.
+// Returns packed bytes - for checks of their layout
+template <typename Policy, typename ... Args>
+inline std::vector<std::int8_t> require_same_unpacked_with(const Args& ... args)
+{
+    std::vector<std::int8_t> bytes( rt::serialization::max_bytes_count_with<Policy>(args...) );
+    bytes.resize( rt::serialization::pack_with<Policy>(bytes.data(), args...) );
+
+    rt::serialization::writer out;
+    rt::serialization::pack_with<Policy>(out, args...);
+    REQUIRE( std::vector<std::int8_t>(out.data(), out.data() + out.size()) == bytes );
+
+    std::tuple<Args...> unpacked;
+    const std::size_t unpacked_count = rt::serialization::unpack_with<Policy>(bytes.data(), unpacked);
+
+    REQUIRE( unpacked_count == bytes.size() );
+    REQUIRE( unpacked == std::tie(args...) );
+
+    return bytes;
+}
+
 TEST_CASE( "Run-time Simple Serialization/Deserialization works", "[rt][ser/deser]"  )
 {
     const auto bytes = pack_into_bytes
@@ -287,3 +351,819 @@ SCENARIO( "Run-time Nested Serialization/Deserialization works", "[rt][ser/deser
         }
     }
 }
+
+TEST_CASE( "Run-time Byte order policy works", "[rt][ser/deser][byte_order]" )
+{
+    const std::uint32_t value = 0x01020304;
+    std::vector<std::uint32_t> vec;
+    for(std::uint32_t i = 0; i < 37; ++i) {
+        vec.push_back(i * 0x01010101u);
+    }
+    const std::deque< std::pair<std::int16_t, double> > deque = { {-1, 2.5}, {3, -4.75} };
+
+    SECTION( "Values packed in big-endian byte order" )
+    {
+        const std::vector<std::int8_t> bytes = require_same_unpacked_with<big_endian_t>(value, vec, deque);
+
+        REQUIRE( bytes.size() == rt::serialization::bytes_count(value, vec, deque) );
+        REQUIRE( bytes[0] == 0x01 );
+        REQUIRE( bytes[3] == 0x04 );
+
+        // Vector size
+        REQUIRE( bytes[4] == 0 );
+        REQUIRE( bytes[7] == 37 );
+
+        // Vector item #2 (0x02020202) bytes are the same in any order, but
+        // item #1 (0x01010101) + 1 byte from item #2 is not
+        REQUIRE( bytes[8 + 4 + 3] == 0x01 );
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+namespace {
+
+// With hand-written traits, without policy support (plain pack() & unpack())
+struct legacy_point
+{
+    std::int16_t x;
+    std::int16_t y;
+};
+
+bool operator==(const legacy_point& l, const legacy_point& r) {
+    return (l.x == r.x) && (l.y == r.y);
+}
+
+} // namespace
+
+namespace rt {
+namespace serialization {
+
+template <>
+struct bytes_count_trait<legacy_point>
+{
+    static std::size_t bytes_count(const legacy_point& ) {
+        return sizeof(std::int16_t) * 2;
+    }
+};
+
+template <>
+struct pack_trait<legacy_point>
+{
+    static std::size_t pack(std::int8_t* dest, std::size_t offset, const legacy_point& value)
+    {
+        offset = pack_trait<std::int16_t>::pack(dest, offset, value.x);
+        offset = pack_trait<std::int16_t>::pack(dest, offset, value.y);
+        return offset;
+    }
+};
+
+template <>
+struct unpack_trait<legacy_point>
+{
+    static std::size_t unpack(const std::int8_t* src, std::size_t offset, legacy_point& value)
+    {
+        offset = unpack_trait<std::int16_t>::unpack(src, offset, value.x);
+        offset = unpack_trait<std::int16_t>::unpack(src, offset, value.y);
+        return offset;
+    }
+};
+
+} // namespace serialization
+} // namespace rt
+
+TEST_CASE( "Run-time Custom traits without policy support work", "[rt][ser/deser]" )
+{
+    const legacy_point point = { 1, -2 };
+    const std::vector<legacy_point> points = { {3, 4}, {-5, 6} };
+
+    SECTION( "Values are packed by plain pack() of trait" )
+    {
+        const std::vector<std::int8_t> bytes = pack_into_bytes(std::int8_t{7}, point, points);
+
+        REQUIRE( bytes.size() == (1 + 4 + sizeof(rt::serialization::stl::collection_size_t) + (2 * 4)) );
+
+        std::int16_t y = 0;
+        std::memcpy(&y, bytes.data() + 1 + 2, sizeof(y));
+        REQUIRE( y == point.y );
+    }
+
+    SECTION( "Unpacking produces the same data" )
+    {
+        require_same_unpacked_with<rt::serialization::default_policy>(std::int8_t{7}, point, points);
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+namespace {
+
+struct person
+{
+    std::int32_t id;
+    float weight;
+    std::vector<std::int16_t> scores;
+    std::int16_t age;
+    std::int16_t height;
+};
+
+bool operator==(const person& l, const person& r) {
+    return (l.id == r.id) && (l.weight == r.weight) && (l.scores == r.scores) && (l.age == r.age) && (l.height == r.height);
+}
+
+} // namespace
+
+namespace rt {
+namespace serialization {
+
+template <>
+struct members_trait<person>
+        : members<
+            RT_SERIALIZATION_MEMBER(&person::id),
+            RT_SERIALIZATION_MEMBER(&person::weight),
+            RT_SERIALIZATION_MEMBER(&person::scores),
+            RT_SERIALIZATION_MEMBER(&person::age),
+            RT_SERIALIZATION_MEMBER(&person::height)
+        >
+{};
+
+} // namespace serialization
+} // namespace rt
+
+TEST_CASE( "Run-time Registered members Serialization/Deserialization works", "[rt][ser/deser][members]" )
+{
+    const person value { 42, 71.5f, {3, -1, 4}, 33, 180 };
+
+    SECTION( "Fixed part of bytes count is compile-time constant" )
+    {
+        constexpr std::size_t FIXED_BYTES_COUNT = rt::serialization::bytes_count_trait<person>::fixed_bytes_count;
+
+        REQUIRE( FIXED_BYTES_COUNT == (4 + 4 + 2 + 2) );
+        REQUIRE( rt::serialization::bytes_count(value) == (FIXED_BYTES_COUNT + sizeof(std::uint32_t) + (3 * 2)) );
+
+        constexpr bool IS_FIXED = rt::serialization::fixed_bytes_count_trait<person>::is_fixed;
+        REQUIRE( IS_FIXED == false ); // Because of std::vector
+    }
+
+    SECTION( "Members are packed the same way as if they were listed by hand" )
+    {
+        REQUIRE( pack_into_bytes(value) == pack_into_bytes(value.id, value.weight, value.scores, value.age, value.height) );
+
+        std::vector<std::int8_t> bytes( rt::serialization::bytes_count(value) );
+        std::vector<std::int8_t> expected( bytes.size() );
+
+        rt::serialization::pack_with<big_endian_t>(bytes.data(), value);
+        rt::serialization::pack_with<big_endian_t>(expected.data(), value.id, value.weight, value.scores, value.age, value.height);
+
+        REQUIRE( bytes == expected );
+    }
+
+    SECTION( "Unpacking produces the same data" )
+    {
+        const auto bytes = pack_into_bytes(value, std::vector<person>{ value, value });
+
+        person unpacked {};
+        std::vector<person> unpacked_vec;
+        const std::size_t unpacked_count = rt::serialization::unpack(bytes.data(), unpacked, unpacked_vec);
+
+        REQUIRE( unpacked_count == bytes.size() );
+        REQUIRE( unpacked == value );
+        REQUIRE( unpacked_vec == std::vector<person>{ value, value } );
+
+        require_same_unpacked_with<big_endian_t>(value, std::vector<person>{ value, value });
+    }
+}
+
+TEST_CASE( "Run-time Single-pass packing into growable writer works", "[rt][ser/deser][writer]" )
+{
+    const std::uint32_t value = 0x01020304;
+    const std::vector< std::vector<std::int16_t> > nested = { {1, 2}, {}, {3, 4, 5} };
+    const std::list< std::pair<std::int8_t, std::deque<float>> > list = { {1, {2.5f}}, {3, {4.5f, 5.5f}} };
+    const std::vector< std::pair<std::int32_t, float> > flat = { {1, 2.f}, {3, 4.f} };
+    const person registered { 42, 71.5f, {3, -1, 4}, 33, 180 };
+
+    SECTION( "Bytes are the same as for two-pass packing" )
+    {
+        rt::serialization::writer out;
+        rt::serialization::pack(out, value, nested, list, flat, registered);
+
+        REQUIRE( std::vector<std::int8_t>(out.data(), out.data() + out.size()) == pack_into_bytes(value, nested, list, flat, registered) );
+
+        out.release();
+        REQUIRE( out.size() == 0 );
+    }
+
+    SECTION( "Policy is respected" )
+    {
+        require_same_unpacked_with<big_endian_t>(value, nested, list, registered);
+    }
+
+    SECTION( "Buffer is handed back without copying" )
+    {
+        rt::serialization::writer out( 1024 );
+        REQUIRE( out.capacity() >= 1024 );
+
+        rt::serialization::pack(out, nested, list);
+        const std::int8_t* data = out.data();
+
+        const rt::serialization::writer::buffer_t bytes = out.release();
+        REQUIRE( bytes.data() == data );
+
+        std::vector< std::vector<std::int16_t> > nested_unpacked;
+        std::list< std::pair<std::int8_t, std::deque<float>> > list_unpacked;
+        const std::size_t unpacked_count = rt::serialization::unpack(bytes.data(), nested_unpacked, list_unpacked);
+
+        REQUIRE( unpacked_count == bytes.size() );
+        REQUIRE( nested_unpacked == nested );
+        REQUIRE( list_unpacked == list );
+    }
+}
+
+TEST_CASE( "Run-time Single-pass packing into segmented rope writer works", "[rt][ser/deser][writer]" )
+{
+    const auto join = [](const std::vector<rt::serialization::rope_writer::slice>& slices) {
+        std::vector<std::int8_t> bytes;
+        for(const auto& slice : slices) {
+            bytes.insert(bytes.end(), slice.data, slice.data + slice.size);
+        }
+        return bytes;
+    };
+
+    const std::vector<float> samples = { 1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f, 9.f, 10.f, 11.f };
+    const std::vector< std::vector<std::int16_t> > nested = { {1, 2}, {}, {3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13} };
+    const std::vector< std::pair<std::int32_t, float> > flat = { {1, 2.f}, {3, 4.f}, {5, 6.f}, {7, 8.f} };
+    const person registered { 42, 71.5f, {3, -1, 4}, 33, 180 };
+
+    rt::serialization::chunk_pool pool( 16 );
+
+    SECTION( "Joined slices are the same as bytes of two-pass packing" )
+    {
+        rt::serialization::rope_writer out( pool );
+        rt::serialization::pack(out, samples, nested, flat, registered);
+
+        const auto slices = out.slices();
+
+        REQUIRE( slices.size() > 1 );
+        for(const auto& slice : slices) {
+            REQUIRE( slice.size <= pool.chunk_size() );
+        }
+
+        REQUIRE( out.size() == rt::serialization::bytes_count(samples, nested, flat, registered) );
+        REQUIRE( join(slices) == pack_into_bytes(samples, nested, flat, registered) );
+    }
+
+    SECTION( "Policy is respected" )
+    {
+        rt::serialization::rope_writer out( pool );
+        rt::serialization::pack_with<big_endian_t>(out, samples, registered);
+
+        REQUIRE( join(out.slices()) == require_same_unpacked_with<big_endian_t>(samples, registered) );
+    }
+
+    SECTION( "Single value bigger than chunk gets own segment" )
+    {
+        const std::array<std::int64_t, 3> big { {1, 2, 3} };
+
+        rt::serialization::rope_writer out( pool );
+        rt::serialization::pack(out, std::int8_t{1}, big);
+
+        const auto slices = out.slices();
+
+        REQUIRE( slices.size() == 2 );
+        REQUIRE( slices[1].size == (4 + (8 * 3)) );
+        REQUIRE( join(slices) == pack_into_bytes(std::int8_t{1}, big) );
+    }
+
+    SECTION( "Chunks are reused after clearing" )
+    {
+        rt::serialization::rope_writer out( pool );
+        rt::serialization::pack(out, samples);
+
+        const std::size_t chunks_count = out.slices().size();
+        out.clear();
+
+        REQUIRE( out.size() == 0 );
+        REQUIRE( pool.free_count() == chunks_count );
+
+        rt::serialization::pack(out, samples);
+
+        REQUIRE( pool.free_count() == 0 );
+        REQUIRE( join(out.slices()) == pack_into_bytes(samples) );
+    }
+}
+
+TEST_CASE( "Run-time Serialization/Deserialization of containers with custom allocators works", "[rt][ser/deser][arena]" )
+{
+    using rt::serialization::arena_vector;
+    using rt::serialization::arena_deque;
+    using rt::serialization::arena_list;
+
+    const std::vector< std::vector<std::int16_t> > nested = { {1, 2}, {}, {3, 4, 5} };
+    const std::list< std::pair<std::int8_t, std::deque<float>> > list = { {1, {2.5f}}, {3, {4.5f, 5.5f}} };
+
+    const std::vector<std::int8_t> bytes = pack_into_bytes(nested, list);
+
+    rt::serialization::arena memory( 256 );
+
+    SECTION( "Unpacked values are the same, nested containers use the same arena" )
+    {
+        arena_vector< arena_vector<std::int16_t> > nested_unpacked( rt::serialization::make_arena_allocator(memory) );
+        arena_list< std::pair<std::int8_t, arena_deque<float>> > list_unpacked( rt::serialization::make_arena_allocator(memory) );
+
+        const std::size_t unpacked_count = rt::serialization::unpack(bytes.data(), nested_unpacked, list_unpacked);
+
+        REQUIRE( unpacked_count == bytes.size() );
+
+        REQUIRE( nested_unpacked.size() == nested.size() );
+        for(std::size_t i = 0; i < nested.size(); ++i) {
+            REQUIRE( std::equal(nested[i].begin(), nested[i].end(), nested_unpacked[i].begin()) );
+            REQUIRE( nested_unpacked[i].get_allocator() == rt::serialization::make_arena_allocator<std::int16_t>(memory) );
+        }
+
+        REQUIRE( list_unpacked.size() == list.size() );
+        REQUIRE( list_unpacked.back().first == 3 );
+        REQUIRE( list_unpacked.back().second.size() == 2 );
+        REQUIRE( list_unpacked.back().second[1] == 5.5f );
+        REQUIRE( list_unpacked.back().second.get_allocator() == rt::serialization::make_arena_allocator<float>(memory) );
+
+        REQUIRE( memory.capacity() > 0 );
+
+        // The same values are packed back
+        REQUIRE( pack_into_bytes(nested_unpacked, list_unpacked) == bytes );
+    }
+
+    SECTION( "Keys of associative containers use the same arena" )
+    {
+        using key_t = arena_vector<std::int16_t>;
+        using map_t = std::map< key_t, std::int8_t, std::less<key_t>, rt::serialization::arena_allocator< std::pair<const key_t, std::int8_t> > >;
+        using set_t = std::set< key_t, std::less<key_t>, rt::serialization::arena_allocator<key_t> >;
+
+        const std::map< std::vector<std::int16_t>, std::int8_t > map = { {{1, 2}, 3}, {{4}, 5} };
+        const std::set< std::vector<std::int16_t> > set = { {6, 7}, {} };
+
+        const std::vector<std::int8_t> keys_bytes = pack_into_bytes(map, set);
+
+        map_t map_unpacked( rt::serialization::make_arena_allocator< std::pair<const key_t, std::int8_t> >(memory) );
+        set_t set_unpacked( rt::serialization::make_arena_allocator<key_t>(memory) );
+
+#if RT_SERIALIZATION_HAS_PMR
+        // Temporary keys are not allocated on heap
+        std::pmr::memory_resource* const default_resource = std::pmr::set_default_resource( std::pmr::null_memory_resource() );
+        const std::size_t unpacked_count = rt::serialization::unpack(keys_bytes.data(), map_unpacked, set_unpacked);
+        std::pmr::set_default_resource(default_resource);
+#else
+        const std::size_t unpacked_count = rt::serialization::unpack(keys_bytes.data(), map_unpacked, set_unpacked);
+#endif
+
+        REQUIRE( unpacked_count == keys_bytes.size() );
+        REQUIRE( pack_into_bytes(map_unpacked, set_unpacked) == keys_bytes );
+
+        REQUIRE( map_unpacked.begin()->first.get_allocator() == rt::serialization::make_arena_allocator<std::int16_t>(memory) );
+        REQUIRE( set_unpacked.rbegin()->get_allocator() == rt::serialization::make_arena_allocator<std::int16_t>(memory) );
+    }
+
+    SECTION( "Arena blocks are reused after reset" )
+    {
+        std::size_t capacity = 0;
+
+        for(int message = 0; message < 3; ++message)
+        {
+            {
+                arena_vector< arena_vector<std::int16_t> > nested_unpacked( rt::serialization::make_arena_allocator(memory) );
+                arena_list< std::pair<std::int8_t, arena_deque<float>> > list_unpacked( rt::serialization::make_arena_allocator(memory) );
+
+                rt::serialization::unpack(bytes.data(), nested_unpacked, list_unpacked);
+
+                REQUIRE( nested_unpacked[2].back() == 5 );
+            }
+
+            if(message == 0) {
+                capacity = memory.capacity();
+            }
+            REQUIRE( memory.capacity() == capacity );
+
+            memory.reset();
+        }
+    }
+}
+
+namespace {
+
+// Count of value-initialized (zero-filled) items, created by
+// `counting_allocator<T>` (for example - by `resize()`)
+inline std::size_t& value_initialized_count()
+{
+    static std::size_t count = 0;
+    return count;
+}
+
+template <typename T>
+struct counting_allocator
+{
+    using value_type = T;
+
+    counting_allocator() = default;
+
+    template <typename U>
+    counting_allocator(const counting_allocator<U>& ) noexcept
+    {}
+
+    T* allocate(std::size_t count) {
+        return std::allocator<T>().allocate(count);
+    }
+
+    void deallocate(T* items, std::size_t count) noexcept {
+        std::allocator<T>().deallocate(items, count);
+    }
+
+    template <typename U>
+    void construct(U* item)
+    {
+        ++value_initialized_count();
+        ::new( static_cast<void*>(item) ) U();
+    }
+
+    template <typename U, typename ... Args>
+    void construct(U* item, Args&& ... args) {
+        ::new( static_cast<void*>(item) ) U( std::forward<Args>(args)... );
+    }
+};
+
+template <typename T, typename U>
+inline bool operator==(const counting_allocator<T>& , const counting_allocator<U>& ) noexcept {
+    return true;
+}
+
+template <typename T, typename U>
+inline bool operator!=(const counting_allocator<T>& , const counting_allocator<U>& ) noexcept {
+    return false;
+}
+
+} // namespace
+
+TEST_CASE( "Run-time Scalar items are constructed from packed bytes directly", "[rt][ser/deser]" )
+{
+    const std::vector<std::int32_t> vec = { 1, -2, 3, 0x01020304 };
+    const std::deque<double> deque = { 1.5, 2.5 };
+    const std::list<std::int16_t> list = { 7, 8, 9 };
+    const std::forward_list<std::uint64_t> forward_list = { 10, 11 };
+
+    std::vector<std::int8_t> bytes( rt::serialization::bytes_count(vec, deque, list, forward_list) );
+
+    SECTION( "Previous items are replaced" )
+    {
+        rt::serialization::pack(bytes.data(), vec, deque, list, forward_list);
+
+        std::vector<std::int32_t> vec_unpacked = { 5, 6, 7, 8, 9, 10 };
+        std::deque<double> deque_unpacked = { 3.5 };
+        std::list<std::int16_t> list_unpacked = { 1, 2, 3, 4 };
+        std::forward_list<std::uint64_t> forward_list_unpacked;
+
+        const std::size_t unpacked_count = rt::serialization::unpack(bytes.data(), vec_unpacked, deque_unpacked, list_unpacked, forward_list_unpacked);
+
+        REQUIRE( unpacked_count == bytes.size() );
+        REQUIRE( vec_unpacked == vec );
+        REQUIRE( deque_unpacked == deque );
+        REQUIRE( list_unpacked == list );
+        REQUIRE( forward_list_unpacked == forward_list );
+    }
+
+    SECTION( "Policy is respected" )
+    {
+        const std::vector<std::int8_t> big_endian_bytes = require_same_unpacked_with<big_endian_t>(vec, deque, list, forward_list);
+
+        REQUIRE( big_endian_bytes[sizeof(rt::serialization::stl::collection_size_t) + (3 * sizeof(std::int32_t))] == 0x01 );
+    }
+
+    SECTION( "Items are not zero-filled before unpacking" )
+    {
+        std::vector< std::int32_t, counting_allocator<std::int32_t> > vec_unpacked = { 5, 6 };
+        std::deque< double, counting_allocator<double> > deque_unpacked;
+        std::list< std::int16_t, counting_allocator<std::int16_t> > list_unpacked;
+        std::forward_list< std::uint64_t, counting_allocator<std::uint64_t> > forward_list_unpacked;
+
+        rt::serialization::pack(bytes.data(), vec, deque, list, forward_list);
+
+        value_initialized_count() = 0;
+        rt::serialization::unpack(bytes.data(), vec_unpacked, deque_unpacked, list_unpacked, forward_list_unpacked);
+
+        REQUIRE( value_initialized_count() == 0 );
+        REQUIRE( std::vector<std::int32_t>(vec_unpacked.begin(), vec_unpacked.end()) == vec );
+        REQUIRE( std::deque<double>(deque_unpacked.begin(), deque_unpacked.end()) == deque );
+        REQUIRE( std::list<std::int16_t>(list_unpacked.begin(), list_unpacked.end()) == list );
+        REQUIRE( std::forward_list<std::uint64_t>(forward_list_unpacked.begin(), forward_list_unpacked.end()) == forward_list );
+
+        // Other byte order - items are swapped after construction
+        const std::vector<std::int8_t> big_endian_bytes = require_same_unpacked_with<big_endian_t>(vec, deque, list, forward_list);
+
+        value_initialized_count() = 0;
+        rt::serialization::unpack_with<big_endian_t>(big_endian_bytes.data(), vec_unpacked, deque_unpacked, list_unpacked, forward_list_unpacked);
+
+        REQUIRE( value_initialized_count() == 0 );
+        REQUIRE( std::vector<std::int32_t>(vec_unpacked.begin(), vec_unpacked.end()) == vec );
+        REQUIRE( std::deque<double>(deque_unpacked.begin(), deque_unpacked.end()) == deque );
+        REQUIRE( std::list<std::int16_t>(list_unpacked.begin(), list_unpacked.end()) == list );
+        REQUIRE( std::forward_list<std::uint64_t>(forward_list_unpacked.begin(), forward_list_unpacked.end()) == forward_list );
+    }
+}
+
+TEST_CASE( "Run-time Unpacking into views of source bytes works", "[rt][ser/deser][views]" )
+{
+    const std::vector<float> samples = { 1.5f, -2.5f, 3.25f };
+    const std::vector<char> name = { 'v', 'i', 'e', 'w' };
+    const std::int8_t tail = 9; // Items of views are not aligned after it
+
+    SECTION( "Views point into source bytes" )
+    {
+        const std::vector<std::int8_t> bytes = pack_into_bytes(tail, samples, name);
+
+        std::int8_t tail_unpacked = 0;
+        rt::serialization::items_view<float> samples_view;
+        rt::serialization::chars_view name_view;
+
+        const std::size_t unpacked_count = rt::serialization::unpack(bytes.data(), tail_unpacked, samples_view, name_view);
+
+        REQUIRE( unpacked_count == bytes.size() );
+
+        REQUIRE( samples_view.size() == samples.size() );
+        REQUIRE( samples_view.bytes() == (bytes.data() + 1 + sizeof(rt::serialization::stl::collection_size_t)) );
+        REQUIRE( samples_view[2] == samples[2] );
+        REQUIRE( std::vector<float>(samples_view.begin(), samples_view.end()) == samples );
+
+        std::vector<float> copied( samples_view.size() );
+        samples_view.copy_to(copied.data());
+        REQUIRE( copied == samples );
+
+        REQUIRE( name_view.str() == "view" );
+        REQUIRE( name_view == rt::serialization::chars_view("view") );
+        REQUIRE( reinterpret_cast<const std::int8_t*>(name_view.data()) == (bytes.data() + bytes.size() - name.size()) );
+    }
+
+    SECTION( "Views are packed like owning containers" )
+    {
+        const std::vector<std::int8_t> bytes = pack_into_bytes(samples, name);
+
+        rt::serialization::items_view<float> samples_view;
+        rt::serialization::chars_view name_view;
+        rt::serialization::unpack(bytes.data(), samples_view, name_view);
+
+        REQUIRE( pack_into_bytes(samples_view, name_view) == bytes );
+        REQUIRE( pack_into_bytes(rt::serialization::chars_view(std::string("view"))) == pack_into_bytes(name) );
+    }
+
+    SECTION( "Byte order of view is respected" )
+    {
+        const std::vector<std::int8_t> bytes = require_same_unpacked_with<big_endian_t>(samples);
+
+        rt::serialization::items_view<float, big_endian_t> samples_view;
+        rt::serialization::unpack_with<big_endian_t>(bytes.data(), samples_view);
+
+        REQUIRE( std::vector<float>(samples_view.begin(), samples_view.end()) == samples );
+
+        // Repacking in other byte order
+        REQUIRE( pack_into_bytes(samples_view) == pack_into_bytes(samples) );
+    }
+}
+
+TEST_CASE( "Run-time Serialization/Deserialization of associative containers works", "[rt][ser/deser][stl]" )
+{
+    const std::map<std::int32_t, std::vector<std::int16_t>> map = { {3, {1, 2}}, {-1, {}}, {7, {3}} };
+    const std::multimap<std::int8_t, float> multimap = { {1, 1.5f}, {1, 0.5f}, {2, 2.5f} };
+    const std::set<std::int64_t> set = { 5, -6, 7 };
+    const std::multiset<std::vector<std::int8_t>> multiset = { {1, 2}, {1, 2}, {} };
+    const std::unordered_map<std::uint16_t, std::pair<std::int8_t, double>> unordered_map = { {10, {1, 2.0}}, {20, {3, 4.0}} };
+    const std::unordered_set<std::int32_t> unordered_set = { 100, 200, 300 };
+
+    SECTION( "Bytes count of containers of fixed-size items is computed in closed form" )
+    {
+        REQUIRE( rt::serialization::bytes_count(multimap) == (4 + 3 * (1 + 4)) );
+        REQUIRE( rt::serialization::bytes_count(set) == (4 + 3 * 8) );
+        REQUIRE( rt::serialization::bytes_count(map) == (4 + 3 * 4 + (4 + 2 * 2) + 4 + (4 + 2)) );
+    }
+
+    SECTION( "Unpacking produces the same data" )
+    {
+        const std::vector<std::int8_t> bytes = pack_into_bytes(map, multimap, set, multiset, unordered_map, unordered_set);
+
+        std::map<std::int32_t, std::vector<std::int16_t>> map_unpacked = { {42, {42}} }; // Replaced
+        std::multimap<std::int8_t, float> multimap_unpacked;
+        std::set<std::int64_t> set_unpacked;
+        std::multiset<std::vector<std::int8_t>> multiset_unpacked;
+        std::unordered_map<std::uint16_t, std::pair<std::int8_t, double>> unordered_map_unpacked;
+        std::unordered_set<std::int32_t> unordered_set_unpacked;
+
+        const std::size_t unpacked_count = rt::serialization::unpack(bytes.data(), map_unpacked, multimap_unpacked, set_unpacked,
+                                                                     multiset_unpacked, unordered_map_unpacked, unordered_set_unpacked);
+
+        REQUIRE( unpacked_count == bytes.size() );
+        REQUIRE( map_unpacked == map );
+        REQUIRE( multimap_unpacked == multimap ); // Including order of equal keys
+        REQUIRE( set_unpacked == set );
+        REQUIRE( multiset_unpacked == multiset );
+        REQUIRE( unordered_map_unpacked == unordered_map );
+        REQUIRE( unordered_set_unpacked == unordered_set );
+    }
+
+    SECTION( "Single-pass packing and policy are respected" )
+    {
+        require_same_unpacked_with<big_endian_t>(map, multimap, set, unordered_map);
+    }
+}
+
+TEST_CASE( "Run-time Serialization/Deserialization of strings works", "[rt][ser/deser][stl]" )
+{
+    const std::string str = "packed string";
+    const std::string empty;
+    const std::u16string wide = u"wide";
+    const std::vector<std::string> names = { "a", "", "bc" };
+
+    SECTION( "Strings are packed like vectors of characters" )
+    {
+        REQUIRE( rt::serialization::bytes_count(str) == (4 + str.size()) );
+        REQUIRE( rt::serialization::bytes_count(wide) == (4 + 2 * wide.size()) );
+
+        REQUIRE( pack_into_bytes(str) == pack_into_bytes(std::vector<char>(str.begin(), str.end())) );
+        REQUIRE( pack_into_bytes(wide) == pack_into_bytes(std::vector<char16_t>(wide.begin(), wide.end())) );
+    }
+
+    SECTION( "Unpacking produces the same data" )
+    {
+        const std::vector<std::int8_t> bytes = pack_into_bytes(std::int8_t{1}, str, empty, wide, names);
+
+        std::int8_t head = 0;
+        std::string str_unpacked = "previous content";
+        std::string empty_unpacked = "previous content";
+        std::u16string wide_unpacked;
+        std::vector<std::string> names_unpacked;
+
+        const std::size_t unpacked_count = rt::serialization::unpack(bytes.data(), head, str_unpacked, empty_unpacked, wide_unpacked, names_unpacked);
+
+        REQUIRE( unpacked_count == bytes.size() );
+        REQUIRE( str_unpacked == str );
+        REQUIRE( empty_unpacked.empty() );
+        REQUIRE( wide_unpacked == wide );
+        REQUIRE( names_unpacked == names );
+    }
+
+    SECTION( "Policy is respected" )
+    {
+        const std::vector<std::int8_t> bytes = require_same_unpacked_with<big_endian_t>(str, wide, names);
+
+        REQUIRE( bytes[4 + str.size() + 4] == 0 ); // High byte of u'w'
+    }
+
+    SECTION( "Characters are not varint-encoded" )
+    {
+        const std::u16string high = u"\u0416\u00FF wide";
+
+        const std::vector<std::int8_t> bytes = require_same_unpacked_with<rt::serialization::varint_policy>(high);
+
+        REQUIRE( bytes.size() == (1 + 2 * high.size()) ); // Only size is varint
+        const std::vector<std::int8_t> fixed_bytes = pack_into_bytes(high);
+        REQUIRE( std::vector<std::int8_t>(bytes.begin() + 1, bytes.end()) == std::vector<std::int8_t>(fixed_bytes.begin() + 4, fixed_bytes.end()) );
+    }
+}
+
+TEST_CASE( "Run-time Varint encoding of integers works", "[rt][ser/deser][varint]" )
+{
+    using varint_t = rt::serialization::varint_policy;
+
+    const std::int32_t small = -3;
+    const std::uint64_t big = 0xFFFFFFFFFFFFFFFFULL;
+    const std::int64_t min = std::numeric_limits<std::int64_t>::min();
+    const std::array<std::int16_t, 3> array = {{ 1, -300, std::numeric_limits<std::int16_t>::max() }};
+    const std::vector< std::vector<std::uint32_t> > nested = { {1, 2, 300}, {}, {70000} };
+    const std::list<std::int64_t> list = { -1, 1, 1LL << 40 };
+    const std::map<std::uint16_t, std::string> map = { {1, "one"}, {1000, "thousand"} };
+    const std::pair<float, std::int8_t> pair = { 2.5f, -8 };
+    const person registered { 42, 71.5f, {3, -1, 4}, 33, 180 };
+
+    // Mostly single-byte values (decoded by blocks), with some longer ones
+    std::vector<std::int32_t> samples;
+    for(std::int32_t i = 0; i < 100; ++i) {
+        samples.push_back( ((i % 37) == 0) ? (i * 100000) : ((i % 2) ? i / 4 : -(i / 4)) );
+    }
+
+    SECTION( "Small integers and sizes take single byte" )
+    {
+        rt::serialization::writer out;
+        rt::serialization::pack_with<varint_t>(out, small, std::vector<std::int32_t>{ 1, -1, 2, 63 });
+
+        REQUIRE( out.size() == (1 + (1 + 4)) );
+
+        REQUIRE( out.data()[0] == 5 ); // Zigzag: -3 --> 5
+    }
+
+    SECTION( "Unpacking produces the same data" )
+    {
+        const std::vector<std::int8_t> bytes = require_same_unpacked_with<varint_t>(small, big, min, array, nested, list, map, pair, registered, samples);
+
+        REQUIRE( bytes.size() < rt::serialization::bytes_count(small, big, min, array, nested, list, map, pair, registered, samples) );
+    }
+
+    SECTION( "All kinds of outputs produce the same bytes" )
+    {
+        const std::vector<std::int8_t> bytes = require_same_unpacked_with<varint_t>(big, nested, registered, samples);
+
+        rt::serialization::chunk_pool pool( 16 );
+        rt::serialization::rope_writer rope( pool );
+        rt::serialization::pack_with<varint_t>(rope, big, nested, registered, samples);
+
+        std::vector<std::int8_t> joined;
+        for(const auto& slice : rope.slices()) {
+            joined.insert(joined.end(), slice.data, slice.data + slice.size);
+        }
+        REQUIRE( joined == bytes );
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+namespace {
+
+enum class level : std::int16_t
+{
+    low = -1,
+    high = 1000
+};
+
+} // namespace
+
+namespace rt {
+namespace serialization {
+namespace stl {
+
+// Small bounded vectors
+template <>
+struct collection_size_trait< std::vector<level> >
+{
+    using type = std::uint8_t;
+};
+
+// Huge lists
+template <>
+struct collection_size_trait< std::list<level> >
+{
+    using type = std::uint64_t;
+};
+
+} // namespace stl
+} // namespace serialization
+} // namespace rt
+
+TEST_CASE( "Run-time Size types of containers may be specified", "[rt][ser/deser][size]" )
+{
+    const std::vector<level> vec = { level::low, level::high, level::low };
+    const std::list<level> list = { level::high, level::low };
+    const std::vector< std::vector<level> > nested = { vec, {}, vec };
+
+    SECTION( "Bytes count takes size types into account" )
+    {
+        REQUIRE( rt::serialization::bytes_count(vec) == (sizeof(std::uint8_t) + 3 * sizeof(level)) );
+        REQUIRE( rt::serialization::bytes_count(list) == (sizeof(std::uint64_t) + 2 * sizeof(level)) );
+        REQUIRE( rt::serialization::bytes_count(nested) == (sizeof(rt::serialization::stl::collection_size_t) + 3 * sizeof(std::uint8_t) + 6 * sizeof(level)) );
+    }
+
+    SECTION( "Unpacking produces the same data" )
+    {
+        std::vector<std::int8_t> bytes( rt::serialization::bytes_count(vec, list, nested) );
+        const std::size_t packed_count = rt::serialization::pack(bytes.data(), vec, list, nested);
+
+        REQUIRE( packed_count == bytes.size() );
+        REQUIRE( bytes[0] == 3 ); // Single-byte size
+
+        rt::serialization::writer out;
+        rt::serialization::pack(out, vec, list, nested);
+        REQUIRE( std::vector<std::int8_t>(out.data(), out.data() + out.size()) == bytes );
+
+        std::vector<level> vec_unpacked;
+        std::list<level> list_unpacked;
+        std::vector< std::vector<level> > nested_unpacked;
+
+        const std::size_t unpacked_count = rt::serialization::unpack(bytes.data(), vec_unpacked, list_unpacked, nested_unpacked);
+
+        REQUIRE( unpacked_count == packed_count );
+        REQUIRE( vec_unpacked == vec );
+        REQUIRE( list_unpacked == list );
+        REQUIRE( nested_unpacked == nested );
+
+        // View has size type of owning container
+        rt::serialization::items_view<level> view;
+        REQUIRE( rt::serialization::unpack(bytes.data(), view) == rt::serialization::bytes_count(vec) );
+        REQUIRE( std::vector<level>(view.begin(), view.end()) == vec );
+
+        // And with varints
+        require_same_unpacked_with<rt::serialization::varint_policy>(vec, list, nested);
+    }
+
+    SECTION( "Size, which doesn't fit into size type, is not truncated" )
+    {
+        const std::vector<level> too_big( 256, level::high );
+
+        std::vector<std::int8_t> bytes( rt::serialization::bytes_count(too_big) );
+        REQUIRE_THROWS_AS( rt::serialization::pack(bytes.data(), too_big), std::length_error );
+
+        rt::serialization::writer out;
+        REQUIRE_THROWS_AS( rt::serialization::pack(out, too_big), std::length_error );
+    }
+}
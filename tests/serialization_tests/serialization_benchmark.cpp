@@ -0,0 +1,359 @@
+/*
+    Run-time benchmark: `ct::serialization` vs `rt::serialization` vs
+    hand-written `std::memcpy()` code, for several record shapes.
+
+    Each record shape is packed (and unpacked) record-by-record into single
+    contiguous buffer. Records are filled by deterministic generator (fixed
+    seed), so results are reproducible between runs & machines.
+
+    Usage: serialization_benchmark_app [passes]
+
+    For each variant the best (minimal) time of all passes is reported as
+    ns/record and GB/s (of packed bytes). Build with optimizations (Release).
+*/
+
+#include "ct/serialization/ct_serialization_pack.hpp"
+#include "ct/serialization/ct_serialization_unpack.hpp"
+
+#include "rt/serialization/rt_serialization_bytes_count.hpp"
+#include "rt/serialization/rt_serialization_bytes_count_stl.hpp"
+#include "rt/serialization/rt_serialization_pack.hpp"
+#include "rt/serialization/rt_serialization_pack_stl.hpp"
+#include "rt/serialization/rt_serialization_unpack.hpp"
+#include "rt/serialization/rt_serialization_unpack_stl.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib> // for std::atoi()
+#include <cstring> // for std::memcpy()
+#include <limits>
+#include <vector>
+
+namespace {
+
+// -----------------------------------------------------------------------------
+// Deterministic payload generator
+
+// SplitMix64 - the same sequence for the same seed on any platform
+class payload_generator
+{
+public:
+    explicit payload_generator(std::uint64_t seed)
+        : m_state(seed)
+    {}
+
+    std::uint64_t next()
+    {
+        std::uint64_t z = (m_state += 0x9E3779B97F4A7C15ull);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    }
+
+    template <typename T>
+    auto fill(T& value)
+        -> typename std::enable_if< std::is_integral<T>::value, void>::type
+    {
+        value = static_cast<T>( next() );
+    }
+
+    // Finite values only (no NaN), so unpacked records may be compared
+    template <typename T>
+    auto fill(T& value)
+        -> typename std::enable_if< std::is_floating_point<T>::value, void>::type
+    {
+        const double unit = static_cast<double>(next() >> 11) / static_cast<double>(1ull << 53); // [0, 1)
+        value = static_cast<T>( (unit * 2000.0) - 1000.0 );
+    }
+
+    template <typename T, std::size_t SIZE>
+    void fill(std::array<T, SIZE>& array)
+    {
+        for(T& item : array) {
+            fill(item);
+        }
+    }
+
+    template <typename First, typename Second>
+    void fill(std::pair<First, Second>& pair)
+    {
+        fill(pair.first);
+        fill(pair.second);
+    }
+
+    template <typename ... Types>
+    void fill(std::tuple<Types...>& tuple)
+    {
+        fill_tuple(tuple, ct::ind_seq::gen_seq<sizeof...(Types)>{});
+    }
+
+private:
+
+    template <typename ... Types, int ... Indexes>
+    void fill_tuple(std::tuple<Types...>& tuple, ct::ind_seq::index<Indexes...>)
+    {
+        using dummy_t = int[];
+        (void) dummy_t { 0, (fill( std::get<Indexes>(tuple) ), 0) ... };
+    }
+
+    std::uint64_t m_state;
+};
+
+// -----------------------------------------------------------------------------
+// Record shapes. Each one has the same (packed) layout, as produced by
+// `ct::serialization::pack()`, but written by hand
+
+struct flat_scalars
+{
+    using record_t = std::tuple<std::int32_t, std::int64_t, float, double, std::int16_t, std::int8_t>;
+
+    static constexpr const char* name = "flat scalars";
+    static constexpr std::size_t records_count = 64 * 1024;
+
+    static void pack_by_hand(std::int8_t* dest, const record_t& record)
+    {
+        std::memcpy(dest +  0, &std::get<0>(record), sizeof(std::int32_t));
+        std::memcpy(dest +  4, &std::get<1>(record), sizeof(std::int64_t));
+        std::memcpy(dest + 12, &std::get<2>(record), sizeof(float));
+        std::memcpy(dest + 16, &std::get<3>(record), sizeof(double));
+        std::memcpy(dest + 24, &std::get<4>(record), sizeof(std::int16_t));
+        std::memcpy(dest + 26, &std::get<5>(record), sizeof(std::int8_t));
+    }
+
+    static void unpack_by_hand(const std::int8_t* src, record_t& record)
+    {
+        std::memcpy(&std::get<0>(record), src +  0, sizeof(std::int32_t));
+        std::memcpy(&std::get<1>(record), src +  4, sizeof(std::int64_t));
+        std::memcpy(&std::get<2>(record), src + 12, sizeof(float));
+        std::memcpy(&std::get<3>(record), src + 16, sizeof(double));
+        std::memcpy(&std::get<4>(record), src + 24, sizeof(std::int16_t));
+        std::memcpy(&std::get<5>(record), src + 26, sizeof(std::int8_t));
+    }
+};
+
+struct nested_tuples
+{
+    using record_t = std::tuple< std::int32_t, std::pair<std::int8_t, std::int64_t>, std::tuple<float, std::int16_t, double> >;
+
+    static constexpr const char* name = "nested tuples";
+    static constexpr std::size_t records_count = 64 * 1024;
+
+    static void pack_by_hand(std::int8_t* dest, const record_t& record)
+    {
+        std::memcpy(dest +  0, &std::get<0>(record),        sizeof(std::int32_t));
+        std::memcpy(dest +  4, &std::get<1>(record).first,  sizeof(std::int8_t));
+        std::memcpy(dest +  5, &std::get<1>(record).second, sizeof(std::int64_t));
+        std::memcpy(dest + 13, &std::get<0>( std::get<2>(record) ), sizeof(float));
+        std::memcpy(dest + 17, &std::get<1>( std::get<2>(record) ), sizeof(std::int16_t));
+        std::memcpy(dest + 19, &std::get<2>( std::get<2>(record) ), sizeof(double));
+    }
+
+    static void unpack_by_hand(const std::int8_t* src, record_t& record)
+    {
+        std::memcpy(&std::get<0>(record),        src +  0, sizeof(std::int32_t));
+        std::memcpy(&std::get<1>(record).first,  src +  4, sizeof(std::int8_t));
+        std::memcpy(&std::get<1>(record).second, src +  5, sizeof(std::int64_t));
+        std::memcpy(&std::get<0>( std::get<2>(record) ), src + 13, sizeof(float));
+        std::memcpy(&std::get<1>( std::get<2>(record) ), src + 17, sizeof(std::int16_t));
+        std::memcpy(&std::get<2>( std::get<2>(record) ), src + 19, sizeof(double));
+    }
+};
+
+struct array_of_pairs
+{
+    using record_t = std::array< std::pair<std::int32_t, float>, 16 >;
+
+    static constexpr const char* name = "array of pairs";
+    static constexpr std::size_t records_count = 16 * 1024;
+
+    static void pack_by_hand(std::int8_t* dest, const record_t& record)
+    {
+        for(std::size_t i = 0; i < record.size(); ++i) {
+            std::memcpy(dest + (i * 8) + 0, &record[i].first,  sizeof(std::int32_t));
+            std::memcpy(dest + (i * 8) + 4, &record[i].second, sizeof(float));
+        }
+    }
+
+    static void unpack_by_hand(const std::int8_t* src, record_t& record)
+    {
+        for(std::size_t i = 0; i < record.size(); ++i) {
+            std::memcpy(&record[i].first,  src + (i * 8) + 0, sizeof(std::int32_t));
+            std::memcpy(&record[i].second, src + (i * 8) + 4, sizeof(float));
+        }
+    }
+};
+
+struct large_array
+{
+    using record_t = std::array<double, 1024>;
+
+    static constexpr const char* name = "large std::array";
+    static constexpr std::size_t records_count = 1024;
+
+    static void pack_by_hand(std::int8_t* dest, const record_t& record)
+    {
+        std::memcpy(dest, record.data(), sizeof(record_t));
+    }
+
+    static void unpack_by_hand(const std::int8_t* src, record_t& record)
+    {
+        std::memcpy(record.data(), src, sizeof(record_t));
+    }
+};
+
+// -----------------------------------------------------------------------------
+// Measurement
+
+using bench_clock_t = std::chrono::steady_clock;
+
+// Best (minimal) time of single pass over all records, in nanoseconds
+template <typename Pass>
+double measure_best_pass_ns(std::size_t passes, Pass pass)
+{
+    double best_ns = std::numeric_limits<double>::max();
+
+    for(std::size_t i = 0; i < passes; ++i)
+    {
+        const bench_clock_t::time_point start = bench_clock_t::now();
+        pass();
+        const bench_clock_t::time_point finish = bench_clock_t::now();
+
+        const double pass_ns = static_cast<double>( std::chrono::duration_cast<std::chrono::nanoseconds>(finish - start).count() );
+        if(pass_ns < best_ns) {
+            best_ns = pass_ns;
+        }
+    }
+
+    return best_ns;
+}
+
+void print_header()
+{
+    std::printf("%-18s %-8s %-10s %12s %12s %10s\n", "shape", "op", "impl", "bytes/rec", "ns/record", "GB/s");
+}
+
+void print_result(const char* shape, const char* op, const char* impl, std::size_t record_bytes, std::size_t records_count, double pass_ns)
+{
+    const double ns_per_record = pass_ns / static_cast<double>(records_count);
+    const double gb_per_second = static_cast<double>(record_bytes * records_count) / pass_ns; // bytes/ns == GB/s
+
+    std::printf("%-18s %-8s %-10s %12zu %12.2f %10.2f\n", shape, op, impl, record_bytes, ns_per_record, gb_per_second);
+}
+
+// Checksum of packed bytes
+std::uint64_t checksum(const std::vector<std::int8_t>& bytes)
+{
+    std::uint64_t sum = 0;
+    for(const std::int8_t byte : bytes) {
+        sum = (sum * 31) + static_cast<std::uint8_t>(byte);
+    }
+    return sum;
+}
+
+template <typename Shape>
+bool run_shape(std::size_t passes)
+{
+    using record_t = typename Shape::record_t;
+
+    constexpr std::size_t CT_RECORD_BYTES = ct::get_bytes_count<record_t>();
+    constexpr std::size_t RECORDS_COUNT   = Shape::records_count;
+
+    payload_generator generator(/* seed= */ 0x5EED);
+
+    std::vector<record_t> records(RECORDS_COUNT);
+    for(record_t& record : records) {
+        generator.fill(record);
+    }
+    std::vector<record_t> unpacked(RECORDS_COUNT);
+
+    const std::size_t rt_record_bytes = rt::serialization::bytes_count(records.front()); // Including sizes of collections
+
+    std::vector<std::int8_t> ct_bytes  (CT_RECORD_BYTES * RECORDS_COUNT);
+    std::vector<std::int8_t> hand_bytes(CT_RECORD_BYTES * RECORDS_COUNT);
+    std::vector<std::int8_t> rt_bytes  (rt_record_bytes * RECORDS_COUNT);
+
+    // --- Packing -------------------------------------------------------------
+
+    const double ct_pack_ns = measure_best_pass_ns(passes, [&]() {
+        for(std::size_t i = 0; i < RECORDS_COUNT; ++i) {
+            ct::serialization::pack_into(ct_bytes.data() + (i * CT_RECORD_BYTES), records[i]);
+        }
+    });
+
+    const double rt_pack_ns = measure_best_pass_ns(passes, [&]() {
+        std::size_t offset = 0;
+        for(std::size_t i = 0; i < RECORDS_COUNT; ++i) {
+            offset += rt::serialization::pack(rt_bytes.data() + offset, records[i]);
+        }
+    });
+
+    const double hand_pack_ns = measure_best_pass_ns(passes, [&]() {
+        for(std::size_t i = 0; i < RECORDS_COUNT; ++i) {
+            Shape::pack_by_hand(hand_bytes.data() + (i * CT_RECORD_BYTES), records[i]);
+        }
+    });
+
+    print_result(Shape::name, "pack", "ct",   CT_RECORD_BYTES, RECORDS_COUNT, ct_pack_ns);
+    print_result(Shape::name, "pack", "rt",   rt_record_bytes, RECORDS_COUNT, rt_pack_ns);
+    print_result(Shape::name, "pack", "memcpy", CT_RECORD_BYTES, RECORDS_COUNT, hand_pack_ns);
+
+    // --- Unpacking -----------------------------------------------------------
+
+    bool is_valid = (ct_bytes == hand_bytes);
+
+    const double ct_unpack_ns = measure_best_pass_ns(passes, [&]() {
+        for(std::size_t i = 0; i < RECORDS_COUNT; ++i) {
+            ct::serialization::unpack_from(ct_bytes.data() + (i * CT_RECORD_BYTES), unpacked[i]);
+        }
+    });
+    is_valid = is_valid && (unpacked == records);
+
+    const double rt_unpack_ns = measure_best_pass_ns(passes, [&]() {
+        std::size_t offset = 0;
+        for(std::size_t i = 0; i < RECORDS_COUNT; ++i) {
+            offset += rt::serialization::unpack(rt_bytes.data() + offset, unpacked[i]);
+        }
+    });
+    is_valid = is_valid && (unpacked == records);
+
+    const double hand_unpack_ns = measure_best_pass_ns(passes, [&]() {
+        for(std::size_t i = 0; i < RECORDS_COUNT; ++i) {
+            Shape::unpack_by_hand(hand_bytes.data() + (i * CT_RECORD_BYTES), unpacked[i]);
+        }
+    });
+    is_valid = is_valid && (unpacked == records);
+
+    print_result(Shape::name, "unpack", "ct",   CT_RECORD_BYTES, RECORDS_COUNT, ct_unpack_ns);
+    print_result(Shape::name, "unpack", "rt",   rt_record_bytes, RECORDS_COUNT, rt_unpack_ns);
+    print_result(Shape::name, "unpack", "memcpy", CT_RECORD_BYTES, RECORDS_COUNT, hand_unpack_ns);
+
+    // The same payload (and checksum) on any machine with the same byte order
+    std::printf("%-18s checksum: %016llx %s\n\n", Shape::name,
+                static_cast<unsigned long long>( checksum(ct_bytes) ),
+                is_valid ? "" : "(MISMATCH: packed/unpacked data differs)");
+
+    return is_valid;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    const int passes_arg = (argc > 1) ? std::atoi(argv[1]) : 0;
+    const std::size_t passes = (passes_arg > 0) ? static_cast<std::size_t>(passes_arg) : 20;
+
+#if !defined(NDEBUG)
+    std::printf("Warning: built without NDEBUG - probably not optimized build\n\n");
+#endif
+
+    print_header();
+
+    bool is_valid = true;
+    is_valid = run_shape<flat_scalars>  (passes) && is_valid;
+    is_valid = run_shape<nested_tuples> (passes) && is_valid;
+    is_valid = run_shape<array_of_pairs>(passes) && is_valid;
+    is_valid = run_shape<large_array>   (passes) && is_valid;
+
+    return is_valid ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,247 @@
+/*
+    Compile-time cost benchmark of metaprogramming layer (`ct::flattened`,
+    offsets makers, `packer_trait` & `unpacker_trait`).
+
+    For each record shape & size generates translation unit, which packs and
+    unpacks such record, compiles it by the same compiler (and flags), as the
+    tests, and reports compilation wall time & peak memory of compiler.
+
+    Shapes:
+    - `fields` - flat tuple of N scalars (of different types).
+    - `depth`  - pairs nested N times: pair<i8, pair<i16, pair<i32, ...>>>.
+    - `array`  - std::array of N pairs (above `CT_ARRAY_UNROLL_THRESHOLD` -
+      packed by loop).
+
+    Usage: serialization_compile_time_benchmark_app <work_dir> [results.csv]
+
+    Generated sources, objects & results (by default) are written into
+    `work_dir` - it is required, to not litter current directory (CMake target
+    `compile_time_benchmark` passes directory in build tree).
+
+    POSIX-only (compiler is started by fork() & exec(), memory is taken from
+    wait4() resource usage).
+*/
+
+#if defined(__unix__) || defined(__APPLE__)
+    #include <sys/resource.h> // for struct rusage
+    #include <sys/stat.h>     // for mkdir()
+    #include <sys/wait.h>     // for wait4()
+    #include <unistd.h>       // for fork(), execvp()
+    #define CT_BENCHMARK_HAS_POSIX 1
+#endif
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#if !defined(CT_BENCHMARK_CXX_COMPILER)
+    #define CT_BENCHMARK_CXX_COMPILER "c++"
+#endif
+
+#if !defined(CT_BENCHMARK_CXX_FLAGS)
+    #define CT_BENCHMARK_CXX_FLAGS "-std=c++11 -O2"
+#endif
+
+#if !defined(CT_BENCHMARK_INCLUDE_DIR)
+    #define CT_BENCHMARK_INCLUDE_DIR "."
+#endif
+
+namespace {
+
+// -----------------------------------------------------------------------------
+// Generated record types
+
+const char* const scalar_types[] = {
+    "std::int8_t", "std::int16_t", "std::int32_t", "std::int64_t", "float", "double"
+};
+const std::size_t scalar_types_count = sizeof(scalar_types) / sizeof(scalar_types[0]);
+
+std::string make_fields_record(std::size_t fields_count)
+{
+    std::ostringstream out;
+    out << "std::tuple<";
+    for(std::size_t i = 0; i < fields_count; ++i) {
+        out << ((i == 0) ? "" : ", ") << scalar_types[i % scalar_types_count];
+    }
+    out << ">";
+    return out.str();
+}
+
+std::string make_depth_record(std::size_t depth)
+{
+    std::string record = scalar_types[depth % scalar_types_count];
+    for(std::size_t i = depth; i > 0; --i) {
+        record = std::string("std::pair<") + scalar_types[(i - 1) % scalar_types_count] + ", " + record + ">";
+    }
+    return record;
+}
+
+std::string make_array_record(std::size_t items_count)
+{
+    std::ostringstream out;
+    out << "std::array<std::pair<std::int32_t, std::int16_t>, " << items_count << ">";
+    return out.str();
+}
+
+std::string make_translation_unit(const std::string& record)
+{
+    std::ostringstream out;
+    out << "#include \"ct/serialization/ct_serialization_pack.hpp\"\n"
+           "#include \"ct/serialization/ct_serialization_unpack.hpp\"\n"
+           "\n"
+           "using record_t = " << record << ";\n"
+           "using info_t   = ct::serialization::utils::types_sizeofs_info<record_t>;\n"
+           "\n"
+           "static_assert( info_t::get_offsets().size() == ct::flattened<record_t>::type::count, \"Offsets count mismatch\");\n"
+           "\n"
+           "void pack_record(std::int8_t* dest, const record_t& record) {\n"
+           "    ct::serialization::pack_into(dest, record);\n"
+           "}\n"
+           "\n"
+           "void unpack_record(const std::int8_t* src, record_t& record) {\n"
+           "    ct::serialization::unpack_from(src, record);\n"
+           "}\n";
+    return out.str();
+}
+
+// -----------------------------------------------------------------------------
+// Compilation & measurement
+
+struct compile_result
+{
+    bool   is_compiled;
+    double wall_ms;
+    double peak_mb;
+};
+
+std::vector<std::string> split_flags(const std::string& flags)
+{
+    std::vector<std::string> result;
+    std::istringstream in(flags);
+    std::string flag;
+    while(in >> flag) {
+        result.push_back(flag);
+    }
+    return result;
+}
+
+#if defined(CT_BENCHMARK_HAS_POSIX)
+
+compile_result compile(const std::string& source_path, const std::string& object_path)
+{
+    std::vector<std::string> args;
+    args.push_back(CT_BENCHMARK_CXX_COMPILER);
+    for(const std::string& flag : split_flags(CT_BENCHMARK_CXX_FLAGS)) {
+        args.push_back(flag);
+    }
+    args.push_back(std::string("-I") + CT_BENCHMARK_INCLUDE_DIR);
+    args.push_back("-c");
+    args.push_back(source_path);
+    args.push_back("-o");
+    args.push_back(object_path);
+
+    std::vector<char*> argv;
+    for(std::string& arg : args) {
+        argv.push_back(&arg[0]);
+    }
+    argv.push_back(nullptr);
+
+    const auto start = std::chrono::steady_clock::now();
+
+    const pid_t pid = fork();
+    if(pid == 0) {
+        execvp(argv[0], argv.data());
+        _exit(127); // exec failed
+    }
+
+    int status = 0;
+    struct rusage usage {};
+    const bool is_waited = (pid > 0) && (wait4(pid, &status, 0, &usage) == pid);
+
+    const auto finish = std::chrono::steady_clock::now();
+
+    compile_result result {};
+    result.is_compiled = is_waited && WIFEXITED(status) && (WEXITSTATUS(status) == 0);
+    result.wall_ms = std::chrono::duration<double, std::milli>(finish - start).count();
+#if defined(__APPLE__)
+    result.peak_mb = static_cast<double>(usage.ru_maxrss) / (1024.0 * 1024.0); // bytes
+#else
+    result.peak_mb = static_cast<double>(usage.ru_maxrss) / 1024.0; // kilobytes
+#endif
+    return result;
+}
+
+#endif // defined(CT_BENCHMARK_HAS_POSIX)
+
+struct benchmark_case
+{
+    const char* shape;
+    std::size_t size;
+    std::string record;
+};
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+#if defined(CT_BENCHMARK_HAS_POSIX)
+    if(argc < 2) {
+        std::fprintf(stderr, "Usage: %s <work_dir> [results.csv]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    const std::string work_dir = argv[1];
+    const std::string csv_path = (argc > 2) ? argv[2] : (work_dir + "/compile_time_benchmark.csv");
+
+    mkdir(work_dir.c_str(), 0755); // May already exist
+
+    std::vector<benchmark_case> cases;
+    for(std::size_t fields : {8, 32, 128, 256}) {
+        cases.push_back( benchmark_case{ "fields", fields, make_fields_record(fields) } );
+    }
+    for(std::size_t depth : {4, 16, 64}) {
+        cases.push_back( benchmark_case{ "depth", depth, make_depth_record(depth) } );
+    }
+    for(std::size_t items : {16, 64, 256, 1024, 4096}) {
+        cases.push_back( benchmark_case{ "array", items, make_array_record(items) } );
+    }
+
+    std::ofstream csv(csv_path.c_str());
+    csv << "shape,size,compiled,wall_ms,peak_mb\n";
+
+    std::printf("Compiler: %s %s\n\n", CT_BENCHMARK_CXX_COMPILER, CT_BENCHMARK_CXX_FLAGS);
+    std::printf("%-8s %8s %12s %10s\n", "shape", "size", "wall ms", "peak MB");
+
+    bool is_all_compiled = true;
+    for(const benchmark_case& test_case : cases)
+    {
+        const std::string name = work_dir + "/" + test_case.shape + "_" + std::to_string(test_case.size);
+
+        std::ofstream(name + ".cpp") << make_translation_unit(test_case.record);
+
+        const compile_result result = compile(name + ".cpp", name + ".o");
+        is_all_compiled = is_all_compiled && result.is_compiled;
+
+        std::printf("%-8s %8zu %12.1f %10.1f %s\n", test_case.shape, test_case.size, result.wall_ms, result.peak_mb,
+                    result.is_compiled ? "" : "(FAILED)");
+        std::fflush(stdout);
+
+        csv << test_case.shape << ',' << test_case.size << ',' << (result.is_compiled ? 1 : 0) << ','
+            << result.wall_ms << ',' << result.peak_mb << '\n';
+    }
+
+    std::printf("\nResults: %s\n", csv_path.c_str());
+
+    return is_all_compiled ? EXIT_SUCCESS : EXIT_FAILURE;
+#else
+    (void) argc;
+    (void) argv;
+
+    std::printf("Compile-time benchmark is supported only on POSIX systems\n");
+    return EXIT_SUCCESS;
+#endif
+}